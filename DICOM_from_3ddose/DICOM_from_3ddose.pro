@@ -2,7 +2,7 @@
 # Automatically generated by qmake (3.1) Tue Nov 3 11:24:15 2020
 ######################################################################
 
-QT+=widgets
+QT+=widgets concurrent
 TEMPLATE = app
 TARGET = DICOM_from_3ddose
 INCLUDEPATH += .
@@ -18,6 +18,9 @@ DEFINES += QT_DEPRECATED_WARNINGS
 # You can also select to disable deprecated APIs only up to a certain version of Qt.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+# Doses only need to be good to 16 bits for RTDOSE, so store them as floats
+DEFINES += DOSE_SINGLE_PRECISION
+
 # Input
-HEADERS += dose.h
-SOURCES += dose.cpp main.cpp
+HEADERS += DICOM.h dose.h grid.h resample.h textreader.h volume.h
+SOURCES += database.cpp DICOM.cpp writer.cpp dose.cpp resample.cpp textreader.cpp main.cpp
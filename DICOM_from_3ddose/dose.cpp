@@ -13,6 +13,7 @@
 ***********************************************************************/
 
 #include "dose.h"
+#include "textreader.h"
 
 Dose::Dose(const Dose &d)
     : QObject(0) {
@@ -32,24 +33,17 @@ Dose::Dose(const Dose &d)
         cz.append(d.cz[i]);
     }
 
-    // Go through and fill the same doses and errors
-    val.resize(x);
-    err.resize(x);
-    for (int i = 0; i < d.x; i++) {
-        val[i].resize(y);
-        err[i].resize(y);
-        for (int j = 0; j < d.y; j++) {
-            val[i][j].resize(z);
-            err[i][j].resize(z);
-            for (int k = 0; k < d.z; k++) {
-                val[i][j][k] = d.val[i][j][k];
-                err[i][j][k] = d.err[i][j][k];
-            }
-        }
-    }
-
-    // And set the filled flag to true
+    // Copy the doses and errors, each in one block
+    keepError = d.keepError;
     filled = d.filled;
+    if (!val.copyFrom(d.val) || !err.copyFrom(d.err)) {
+        std::cout << "Not enough memory to copy a " << x << "x" << y << "x" << z << " dose, leaving it empty\n";
+        x = y = z = 0;
+        val.clear();
+        err.clear();
+        filled = 0;
+    }
+    updateGrid();
 }
 
 void Dose::copyDose(Dose *other) {
@@ -69,28 +63,24 @@ void Dose::copyDose(Dose *other) {
         cz.append(other->cz[i]);
     }
 
-    // Go through and fill the same doses and errors
-    val.resize(x);
-    err.resize(x);
-    for (int i = 0; i < other->x; i++) {
-        val[i].resize(y);
-        err[i].resize(y);
-        for (int j = 0; j < other->y; j++) {
-            val[i][j].resize(z);
-            err[i][j].resize(z);
-            for (int k = 0; k < other->z; k++) {
-                val[i][j][k] = other->val[i][j][k];
-                err[i][j][k] = other->err[i][j][k];
-            }
-        }
-    }
-
-    // And set the filled flag to true
+    // Copy the doses and errors, each in one block
+    keepError = other->keepError;
     filled = other->filled;
+    if (!val.copyFrom(other->val) || !err.copyFrom(other->err)) {
+        std::cout << "Not enough memory to copy a " << x << "x" << y << "x" << z << " dose, leaving it empty\n";
+        x = y = z = 0;
+        val.clear();
+        err.clear();
+        filled = 0;
+    }
+    updateGrid();
 }
 
 Dose::Dose(QString *path, int n)
     : QObject(0) {
+    x = y = z = 0;
+    keepError = true;
+
     // If we have no path, set filled to false, otherwise, read in the data
     if (path == 0) {
         filled = 0;
@@ -107,14 +97,6 @@ Dose::~Dose() {
     cx.clear();
     cy.clear();
     cz.clear();
-    for (int i = 0; i < x; i++) {
-        for (int j = 0; j < y; j++) {
-            val[i][j].clear();
-            err[i][j].clear();
-        }
-        val[i].clear();
-        err[i].clear();
-    }
     val.clear();
     err.clear();
 }
@@ -176,7 +158,7 @@ double Dose::triInterpol (double xp, double yp, double zp, double *val,
     int xi, yi, zi;
 
     // Define X
-    xi = getIndex ("X", xp);
+    xi = getIndex(XAxis, xp);
     if (xp < (cx[xi] + cx[xi-1])/2.0)
     {
     xi--;
@@ -190,7 +172,7 @@ double Dose::triInterpol (double xp, double yp, double zp, double *val,
     }
 
     // Define Y
-    yi = getIndex ("Y", yp);
+    yi = getIndex(YAxis, yp);
     if (yp < (cy[yi] + cy[yi-1])/2.0)
     {
     yi--;
@@ -204,7 +186,7 @@ double Dose::triInterpol (double xp, double yp, double zp, double *val,
     }
 
     // Define Z
-    zi = getIndex ("Z", zp);
+    zi = getIndex(ZAxis, zp);
     if (zp < (cz[zi] + cz[zi-1])/2.0)
     {
     zi--;
@@ -274,7 +256,7 @@ double Dose::triInterpol(double xp, double yp, double zp, double *val,
     int xi, yi, zi;
 
     // Define X
-    xi = getIndex("X", xp);
+    xi = getIndex(XAxis, xp);
     if (xp < (cx[xi] + cx[xi-1])/2.0) {
         x0 = (cx[xi] + cx[xi-1])/2.0;
         x1 = (cx[xi] + cx[xi+1])/2.0;
@@ -285,7 +267,7 @@ double Dose::triInterpol(double xp, double yp, double zp, double *val,
     }
 
     // Define Y
-    yi = getIndex("Y", yp);
+    yi = getIndex(YAxis, yp);
     if (yp < (cy[yi] + cy[yi-1])/2.0) {
         y0 = (cy[yi] + cy[yi-1])/2.0;
         y1 = (cy[yi] + cy[yi+1])/2.0;
@@ -296,7 +278,7 @@ double Dose::triInterpol(double xp, double yp, double zp, double *val,
     }
 
     // Define Z
-    zi = getIndex("Z", zp);
+    zi = getIndex(ZAxis, zp);
     if (zp < (cz[zi] + cz[zi-1])/2.0) {
         z0 = (cz[zi] + cz[zi-1])/2.0;
         z1 = (cz[zi] + cz[zi+1])/2.0;
@@ -362,57 +344,41 @@ double Dose::triInterpol(double xp, double yp, double zp, double *val,
 }
 
 void Dose::readIn(QString path, int n) {
-    // Open the .3ddose file
-    QFile *file;
-    QTextStream *input;
-    file = new QFile(path);
+    // Open the .3ddose file, which is mapped and parsed in parallel chunks
+    TextReader input;
 
     // Determine the increment size of the status bar this 3ddose file gets
     double increment = Dose::MAX_PROGRESS/double (n);
 
-    if (file->open(QIODevice::ReadOnly | QIODevice::Text)) {
-        input = new QTextStream(file);
-
+    if (input.open(path)) {
         emit progressMade(increment*0.005); // Update progress bar
 
         // Read in the number of voxels
-        *input >> x;
-        *input >> y;
-        *input >> z;
+        int dims[3];
+        if (input.readNumbers(dims, 3) != 3 || dims[0] < 0 || dims[1] < 0 || dims[2] < 0) {
+            failText(path, "dimensions");
+            return;
+        }
+        x = dims[0];
+        y = dims[1];
+        z = dims[2];
 
-        // Resize x appropriately
+        // Resize the boundaries and the voxels appropriately
         cx.resize(x+1);
-        val.resize(x);
-        err.resize(x);
-
-
-        // Resize y appropriately
         cy.resize(y+1);
-        for (int i = 0; i < x; i++) {
-            val[i].resize(y);
-            err[i].resize(y);
-        }
-
-        // Resize z appropriately
         cz.resize(z+1);
-        for (int i = 0; i < x; i++)
-            for (int j = 0; j < y; j++) {
-                val[i][j].resize(z);
-                err[i][j].resize(z);
-            }
+        if (!allocate(path))
+            return;
 
         emit progressMade(increment*0.01); // Update progress bar
 
         // Read in boundaries
-        for (int i = 0; i <= x; i++) {
-            *input >> cx[i];
-        }
-        for (int j = 0; j <= y; j++) {
-            *input >> cy[j];
-        }
-        for (int k = 0; k <= z; k++) {
-            *input >> cz[k];
+        if (input.readNumbers(cx.data(), x+1) != x+1 || input.readNumbers(cy.data(), y+1) != y+1 ||
+            input.readNumbers(cz.data(), z+1) != z+1) {
+            failText(path, "boundaries");
+            return;
         }
+        updateGrid();
 
         emit progressMade(increment*0.01); // Update progress bar
 
@@ -422,32 +388,71 @@ void Dose::readIn(QString path, int n) {
         increment *= 0.975;
         increment = increment/(2*z);
 
-        // Read in all the doses
-        for (int k = 0; k < z; k++) {
-            for (int j = 0; j < y; j++)
-                for (int i = 0; i < x; i++) {
-                    *input >> val[i][j][k];
-                }
+        // Read in all the doses, which are stored in file order, a batch of
+        // slices at a time
+        int batch = qMax(1, (1 << 22)/qMax(1, x*y));
+        for (int k = 0; k < z; k += batch) {
+            int k1 = qMin(z, k+batch);
+            qint64 count = qint64(k1-k)*x*y;
+            if (input.readNumbers(val.slice(k), count) != count) {
+                failText(path, "doses");
+                return;
+            }
+            val.release(k, k1);
 
-            emit progressMade(increment); // Update progress bar
+            for (int s = k; s < k1; s++)
+                emit progressMade(increment); // Update progress bar
         }
 
-        // Read in all the errors
-        for (int k = 0; k < z; k++) {
-            for (int j = 0; j < y; j++)
-                for (int i = 0; i < x; i++) {
-                    *input >> err[i][j][k];
-                }
+        // Read in all the errors, or just read past them if they are not kept
+        QVector <DoseReal> skipped;
+        for (int k = 0; k < z; k += batch) {
+            int k1 = qMin(z, k+batch);
+            qint64 count = qint64(k1-k)*x*y;
+            if (!keepError)
+                skipped.resize(count);
+            if (input.readNumbers(keepError ? err.slice(k) : skipped.data(), count) != count) {
+                failText(path, "errors");
+                return;
+            }
+            if (keepError)
+                err.release(k, k1);
 
-            emit progressMade(increment); // Update progress bar
+            for (int s = k; s < k1; s++)
+                emit progressMade(increment); // Update progress bar
         }
-
-        delete input;
     }
-    delete file;
     filled = 1; // This Dose is now filled
 }
 
+// Report a .3ddose file that ends early or holds something other than a number
+// where one should be, and leave this empty
+void Dose::failText(QString path, QString section) {
+    std::cout << "Could not read the " << section.toStdString() << " of " << path.toStdString()
+              << ", the file is short or malformed, quitting...\n";
+    x = y = z = 0;
+    val.clear();
+    err.clear();
+    filled = 0;
+}
+
+// Resize the voxels (and errors if they are kept) to the grid, returns 0 and
+// leaves the dose empty if there is not enough memory
+int Dose::allocate(QString path) {
+    if (val.resize(x, y, z, 0) && (!keepError || err.resize(x, y, z, 0))) {
+        if (!keepError)
+            err.clear();
+        return 1;
+    }
+
+    std::cout << "Not enough memory to read " << path.toStdString() << ", quitting...\n";
+    x = y = z = 0;
+    val.clear();
+    err.clear();
+    filled = 0;
+    return 0;
+}
+
 void Dose::readBIn(QString path, int n) {
     // Open the .3ddose file
     QFile *file;
@@ -477,25 +482,15 @@ void Dose::readBIn(QString path, int n) {
         *input >> y;
         *input >> z;
 
-        // Resize x appropriately
+        // Resize the boundaries and the voxels appropriately
         cx.resize(x+1);
-        val.resize(x);
-        err.resize(x);
-
-        // Resize y appropriately
         cy.resize(y+1);
-        for (int i = 0; i < x; i++) {
-            val[i].resize(y);
-            err[i].resize(y);
-        }
-
-        // Resize z appropriately
         cz.resize(z+1);
-        for (int i = 0; i < x; i++)
-            for (int j = 0; j < y; j++) {
-                val[i][j].resize(z);
-                err[i][j].resize(z);
-            }
+        if (!allocate(path)) {
+            delete input;
+            delete file;
+            return;
+        }
 
         emit progressMade(increment*0.01); // Update progress bar
 
@@ -509,6 +504,7 @@ void Dose::readBIn(QString path, int n) {
         for (int k = 0; k <= z; k++) {
             *input >> cz[k];
         }
+        updateGrid();
 
         emit progressMade(increment*0.01); // Update progress bar
 
@@ -518,22 +514,32 @@ void Dose::readBIn(QString path, int n) {
         increment *= 0.975;
         increment = increment/(2*z);
 
-        // Read in all the doses
+        // Read in all the doses, always stored as doubles in the file
+        double value;
         for (int k = 0; k < z; k++) {
-            for (int j = 0; j < y; j++)
-                for (int i = 0; i < x; i++) {
-                    *input >> val[i][j][k];
-                }
+            DoseReal *v = val.slice(k);
+            for (int n = 0; n < x*y; n++) {
+                *input >> value;
+                v[n] = value;
+            }
+            val.release(k, k+1);
 
             emit progressMade(increment); // Update progress bar
         }
 
-        // Read in all the errors
+        // Read in all the errors, or skip them if they are not kept
         for (int k = 0; k < z; k++) {
-            for (int j = 0; j < y; j++)
-                for (int i = 0; i < x; i++) {
-                    *input >> err[i][j][k];
+            if (keepError) {
+                DoseReal *e = err.slice(k);
+                for (int n = 0; n < x*y; n++) {
+                    *input >> value;
+                    e[n] = value;
                 }
+                err.release(k, k+1);
+            }
+            else {
+                input->skipRawData(x*y*sizeof(double));
+            }
 
             emit progressMade(increment); // Update progress bar
         }
@@ -593,7 +599,7 @@ void Dose::readOut(QString path, int n) {
         for (int k = 0; k < z; k++) {
             for (int j = 0; j < y; j++)
                 for (int i = 0; i < x; i++) {
-                    *input << QString::number(val[i][j][k]) << tr(" ");
+                    *input << QString::number(double(val(i,j,k))) << tr(" ");
                 }
             emit progressMade(increment); // Update progress bar
         }
@@ -603,7 +609,7 @@ void Dose::readOut(QString path, int n) {
         for (int k = 0; k < z; k++) {
             for (int j = 0; j < y; j++)
                 for (int i = 0; i < x; i++) {
-                    *input << QString::number(err[i][j][k]) << tr(" ");
+                    *input << QString::number(getError(i,j,k)) << tr(" ");
                 }
             emit progressMade(increment); // Update progress bar
         }
@@ -660,7 +666,7 @@ void Dose::readBOut(QString path, int n) {
         for (int k = 0; k < z; k++) {
             for (int j = 0; j < y; j++)
                 for (int i = 0; i < x; i++) {
-                    *input << val[i][j][k];
+                    *input << double(val(i,j,k));
                 }
             emit progressMade(increment); // Update progress bar
         }
@@ -669,7 +675,7 @@ void Dose::readBOut(QString path, int n) {
         for (int k = 0; k < z; k++) {
             for (int j = 0; j < y; j++)
                 for (int i = 0; i < x; i++) {
-                    *input << err[i][j][k];
+                    *input << getError(i,j,k);
                 }
             emit progressMade(increment); // Update progress bar
         }
@@ -690,6 +696,7 @@ int Dose::translate(double dx, double dy, double dz) {
     for (int i = 0; i <= z; i++) {
         cz[i] += dz;
     }
+    updateGrid();
 
     return 1;
 }
@@ -699,6 +706,11 @@ int Dose::strip() {
         return 0;
     }
 
+    Volume <DoseReal> v, e;
+    if (!v.resize(x-2, y-2, z-2) || (!err.isEmpty() && !e.resize(x-2, y-2, z-2))) {
+        return 0; // Not enough memory
+    }
+
     // Remove the first and last positions in the coordinates matrics
     cx.remove(x);
     cy.remove(y);
@@ -707,115 +719,129 @@ int Dose::strip() {
     cy.remove(0);
     cz.remove(0);
 
-    for (int i = 0; i < x; i++) {
-        for (int j = 0; j < y; j++) {
-            // Remove the first and last z value of each (x,y) line
-            val[i][j].remove(z-1);
-            val[i][j].remove(0);
-            err[i][j].remove(z-1);
-            err[i][j].remove(0);
+    // Copy everything but the outer layer of voxels, one row at a time
+    for (int k = 1; k < z-1; k++)
+        for (int j = 1; j < y-1; j++) {
+            memcpy(v.row(j-1, k-1), val.row(j, k)+1, (x-2)*sizeof(DoseReal));
+            if (!err.isEmpty())
+                memcpy(e.row(j-1, k-1), err.row(j, k)+1, (x-2)*sizeof(DoseReal));
         }
-        // Remove the first and last y value of each x line
-        val[i].remove(y-1);
-        val[i].remove(0);
-        err[i].remove(y-1);
-        err[i].remove(0);
-    }
-    // Remove the first and last x values
-    val.remove(x-1);
-    val.remove(0);
-    err.remove(x-1);
-    err.remove(0);
+    val.swap(v);
+    err.swap(e);
 
     // Resize the variables that keep track of size
     x -= 2;
     y -= 2;
     z -= 2;
+    updateGrid();
 
     return 1; // Success
 }
 
-void Dose::subtractDose(Dose *other) {
-    QVector <double> temp; // This holds the original value of this Dose for the
-    // error formula
-    int n = 0;
-    temp.resize(z*y*x);
+int Dose::resample(const QVector <double> &bx, const QVector <double> &by,
+                   const QVector <double> &bz, Resampler::Mode mode) {
+    if (bx.size() < 2 || by.size() < 2 || bz.size() < 2) { // Need one voxel
+        return 0;
+    }
 
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                // Subtract appropriately after saving temp
-                temp[n++] = val[i][j][k];
-                val[i][j][k] = val[i][j][k] - other->val[i][j][k];
-            }
-    n = 0;
+    Resampler resampler(mode);
+    resampler.setGrids(cx, cy, cz, bx, by, bz);
 
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                // for the formula v = v1 - v2
-                // sigma = sqrt((e1*v1)^2 + (e2*v2)^2) [where e is fractional
-                // error]
-                err[i][j][k] = sqrt(pow(err[i][j][k] * temp[n++],2) + pow(other->err[i][j][k] * other->val[i][j][k], 2));
-                // so then e = sigma/v
-                err[i][j][k] = err[i][j][k] / val[i][j][k];
-            }
+    Volume <DoseReal> v, e;
+    if (!resampler.apply(val, &v)) {
+        return 0; // Not enough memory
+    }
+
+    if (!err.isEmpty()) {
+        // Resample the absolute errors the same way as the doses, which
+        // overestimates them (they should be added in quadrature), and then
+        // make them fractional again
+        Volume <DoseReal> sigma;
+        if (!sigma.copyFrom(err)) {
+            return 0; // Not enough memory
+        }
+        for (unsigned long int n = 0; n < sigma.size(); n++)
+            sigma.data()[n] *= val.data()[n];
+        if (!resampler.apply(sigma, &e)) {
+            return 0;
+        }
+        for (unsigned long int n = 0; n < e.size(); n++)
+            e.data()[n] = v.data()[n] != 0 ? e.data()[n]/v.data()[n] : 0;
+    }
+
+    val.swap(v);
+    err.swap(e);
+    cx = bx;
+    cy = by;
+    cz = bz;
+    x = cx.size()-1;
+    y = cy.size()-1;
+    z = cz.size()-1;
+    updateGrid();
+
+    return 1;
+}
+
+void Dose::subtractDose(Dose *other) {
+    DoseReal *v = val.data(), *e = err.data();
+    const DoseReal *ov = other->val.data(), *oe = other->err.data();
+    double temp; // This holds the original value of this Dose for the error
+    // formula
+
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        // Subtract appropriately after saving temp
+        temp = v[n];
+        v[n] = v[n] - ov[n];
+
+        // for the formula v = v1 - v2
+        // sigma = sqrt((e1*v1)^2 + (e2*v2)^2) [where e is fractional
+        // error]
+        // so then e = sigma/v
+        if (e != NULL)
+            e[n] = sqrt(pow(e[n] * temp, 2) + pow((oe != NULL ? oe[n] : 0) * ov[n], 2)) / v[n];
+    }
 }
 
 void Dose::subtractDoseWithError(Dose *other) {
-    QVector <double> temp; // This holds the original value of this Dose for the
+    DoseReal *v = val.data(), *e = err.data();
+    const DoseReal *ov = other->val.data(), *oe = other->err.data();
+    double temp, sigma; // This holds the original value of this Dose for the
     // error formula
-    int n = 0;
-    temp.resize(z*y*x);
 
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                // Subtract appropriately after saving temp
-                temp[n++] = val[i][j][k];
-                val[i][j][k] = val[i][j][k] - other->val[i][j][k];
-            }
-    n = 0;
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        // Subtract appropriately after saving temp
+        temp = v[n];
+        v[n] = v[n] - ov[n];
 
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                // for the formula v = v1 - v2
-                // sigma = sqrt((e1*v1)^2 + (e2*v2)^2) [where e is fractional
-                // error]
-                err[i][j][k] = sqrt(pow(err[i][j][k] * temp[n++],2) + pow(other->err[i][j][k] * other->val[i][j][k], 2));
-                // so then e = sigma/v
-                val[i][j][k] = val[i][j][k] / err[i][j][k];
-            }
+        // for the formula v = v1 - v2
+        // sigma = sqrt((e1*v1)^2 + (e2*v2)^2) [where e is fractional
+        // error]
+        sigma = sqrt(pow((e != NULL ? e[n] : 0) * temp, 2) + pow((oe != NULL ? oe[n] : 0) * ov[n], 2));
+        if (e != NULL)
+            e[n] = sigma;
+        // so then e = sigma/v
+        v[n] = v[n] / sigma;
+    }
 }
 
 void Dose::addDose(Dose *other) {
-    QVector <double> temp; // This holds the original value of this Dose for the
-    // error formula
-    int n = 0;
-    temp.resize(z*y*x);
-
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                // Subtract appropriately after saving temp
-                temp[n++] = val[i][j][k];
-                val[i][j][k] = val[i][j][k] + other->val[i][j][k];
-            }
-    n = 0;
-
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                // for the formula v = v1 - v2
-                // sigma = sqrt((e1*v1)^2 + (e2*v2)^2) [where e is fractional
-                // error]
-                err[i][j][k] = sqrt(pow(err[i][j][k] * temp[n++],2) +
-                                    pow(other->err[i][j][k] *
-                                        other->val[i][j][k], 2));
-                // so then e = sigma/v
-                err[i][j][k] = err[i][j][k] / val[i][j][k];
-            }
+    DoseReal *v = val.data(), *e = err.data();
+    const DoseReal *ov = other->val.data(), *oe = other->err.data();
+    double temp; // This holds the original value of this Dose for the error
+    // formula
+
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        // Add appropriately after saving temp
+        temp = v[n];
+        v[n] = v[n] + ov[n];
+
+        // for the formula v = v1 + v2
+        // sigma = sqrt((e1*v1)^2 + (e2*v2)^2) [where e is fractional
+        // error]
+        // so then e = sigma/v
+        if (e != NULL)
+            e[n] = sqrt(pow(e[n] * temp, 2) + pow((oe != NULL ? oe[n] : 0) * ov[n], 2)) / v[n];
+    }
 }
 
 int Dose::compareDimensions(Dose *other) {
@@ -843,105 +869,90 @@ int Dose::compareDimensions(Dose *other) {
 }
 
 int Dose::divideDose(Dose *other) {
+    DoseReal *v = val.data(), *e = err.data();
+    const DoseReal *ov = other->val.data(), *oe = other->err.data();
     long int count = 0;
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) // Divide appropriatly
-                if (other->val[i][j][k] != 0) {
-                    val[i][j][k] = val[i][j][k]/other->val[i][j][k];
-                }
-                else {
-                    val[i][j][k] = 0.0;
-                    count++;
-                }
 
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) // Recalculate error
-                if (other->val[i][j][k] != 0) {
-                    err[i][j][k] = sqrt(pow(err[i][j][k], 2) + pow(other->err[i][j][k], 2));
-                }
-                else {
-                    err[i][j][k] = 1.0;
-                }
     // If v = v1/v2 then
     //    e = sqrt(e1^2 + e2^2) [where e is fractional error]
+    for (unsigned long int n = 0; n < val.size(); n++)
+        if (ov[n] != 0) { // Divide appropriatly
+            v[n] = v[n]/ov[n];
+            if (e != NULL)
+                e[n] = sqrt(pow(e[n], 2) + pow(oe != NULL ? oe[n] : 0, 2));
+        }
+        else {
+            v[n] = 0.0;
+            if (e != NULL)
+                e[n] = 1.0;
+            count++;
+        }
+
     return count;
 }
 
 void Dose::localDose(Dose *other) {
-    QVector <double> temp; // This holds the original value of this Dose for the
-    // error formula
-    int n = 0;
-    temp.resize(z*y*x);
-
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                // save temp
-                temp[n++] = val[i][j][k];
-                // subtract distributions
-                val[i][j][k] = val[i][j][k] - other->val[i][j][k];
-                // if denominator is nonzero, divide and multiply by 100
-                // else set to zero
-                if (other->val[i][j][k] != 0) {
-                    val[i][j][k] = 100*val[i][j][k]/other->val[i][j][k];
-                }
-                else {
-                    val[i][j][k] = 0.0;
-                }
-            }
-    n = 0;
+    DoseReal *v = val.data(), *e = err.data();
+    const DoseReal *ov = other->val.data(), *oe = other->err.data();
+    double temp; // This holds the original value of this Dose for the error
+    // formula
+
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        // save temp
+        temp = v[n];
+        // subtract distributions
+        v[n] = v[n] - ov[n];
+        // if denominator is nonzero, divide and multiply by 100
+        // else set to zero
+        if (ov[n] != 0) {
+            v[n] = 100*v[n]/ov[n];
+        }
+        else {
+            v[n] = 0.0;
+        }
 
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                // for the formula v = (v1 - v2)/v2
-                // sigma = sqrt((e1*v1)^2 + (e2*v2)^2) [where e is fractional
-                // error]
-                err[i][j][k] = sqrt(pow(err[i][j][k] * temp[n++],2) + pow(other->err[i][j][k] * other->val[i][j][k], 2));
-                // so then e = sigma/v
-                err[i][j][k] = err[i][j][k] / val[i][j][k];
-            }
+        // for the formula v = (v1 - v2)/v2
+        // sigma = sqrt((e1*v1)^2 + (e2*v2)^2) [where e is fractional
+        // error]
+        // so then e = sigma/v
+        if (e != NULL)
+            e[n] = sqrt(pow(e[n] * temp, 2) + pow((oe != NULL ? oe[n] : 0) * ov[n], 2)) / v[n];
+    }
 }
 
 int Dose::getIndex(QString axis, double val) {
-    // This algorithm checks to see if val is within the outer bounds of axis'
-    // coord array, then checks from c[0] to c[x] until it finds a c[n] smaller
-    // than val and returns it's index
-
-    int index = -1;
-    if (!axis.compare("X")) {
-        if (val <= cx[0] || val >= cx[x]) {
-            return index;
-        }
+    if (!axis.compare("X"))
+        return getIndex(XAxis, val);
+    else if (!axis.compare("Y"))
+        return getIndex(YAxis, val);
+    else if (!axis.compare("Z"))
+        return getIndex(ZAxis, val);
+    return -1;
+}
 
-        for (int i = 0; i <= x; i++)
-            if (cx[i] <= val) {
-                index = i;
-            }
+int Dose::getIndex(Axis axis, double p) {
+    // This checks to see if p is within the outer bounds of axis' coord
+    // array, then finds the c[n] at or below it through the grid accelerator
+    const QVector <double> &c = axis == XAxis ? cx : (axis == YAxis ? cy : cz);
+    if (c.isEmpty() || p <= c.first()) {
+        return -1;
     }
-    else if (!axis.compare("Y")) {
-        if (val <= cy[0] || val >= cy[y]) {
-            return index;
-        }
 
-        for (int i = 0; i <= y; i++)
-            if (cy[i] <= val) {
-                index = i;
-            }
-    }
-    else if (!axis.compare("Z")) {
-        if (val <= cz[0] || val >= cz[z]) {
-            return index;
-        }
+    if (axis == XAxis)
+        return gx.lower(p);
+    else if (axis == YAxis)
+        return gy.lower(p);
+    return gz.lower(p); // Will return -1 on failure to find
+}
 
-        for (int i = 0; i <= z; i++)
-            if (cz[i] <= val) {
-                index = i;
-            }
-    }
-    return index; // Will return -1 on failure to find
+void Dose::updateGrid() {
+    gx.build(cx);
+    gy.build(cy);
+    gz.build(cz);
+}
+
+void Dose::getPlane(Axis axis, int n, QVector <DoseReal> *out) {
+    extractPlane(val, axis, n, out);
 }
 
 double Dose::getDose(int ix, int iy, int iz) {
@@ -950,7 +961,7 @@ double Dose::getDose(int ix, int iy, int iz) {
         return -1;    // If outside of bounds, return -1
     }
 
-    return val[ix][iy][iz];
+    return val(ix,iy,iz);
 }
 
 double Dose::getError(int ix, int iy, int iz) {
@@ -959,68 +970,66 @@ double Dose::getError(int ix, int iy, int iz) {
         return -1;    // If outside of bounds, return -1
     }
 
-    return err[ix][iy][iz];
+    return err.isEmpty() ? 0 : err(ix,iy,iz); // No error was kept
 }
 
 double Dose::getDose(double px, double py, double pz) {
     // Convert real numbers to indices and return dose at index
-    int ix = getIndex("X", px);
-    int iy = getIndex("Y", py);
-    int iz = getIndex("Z", pz);
+    int ix = getIndex(XAxis, px);
+    int iy = getIndex(YAxis, py);
+    int iz = getIndex(ZAxis, pz);
     if (iz == -1 || iy == -1 || ix == -1) {
         return -1;    // If outside of bounds, return -1
     }
 
-    return val[ix][iy][iz];
+    return val(ix,iy,iz);
 }
 
 double Dose::getError(double px, double py, double pz) {
     // Convert real numbers to indices and return error at index
-    int ix = getIndex("X", px);
-    int iy = getIndex("Y", py);
-    int iz = getIndex("Z", pz);
+    int ix = getIndex(XAxis, px);
+    int iy = getIndex(YAxis, py);
+    int iz = getIndex(ZAxis, pz);
     if (iz == -1 || iy == -1 || ix == -1) {
         return -1;    // If outside of bounds, return -1
     }
 
-    return err[ix][iy][iz];
+    return err.isEmpty() ? 0 : err(ix,iy,iz); // No error was kept
 }
 
 double Dose::getMax() {
-    double max = val[0][0][0];
+    const DoseReal *v = val.data();
+    double max = v[0];
 
     // Iterate through all dose to get largest and smallest dose
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++)
-                if (val[i][j][k] > max) {
-                    max = val[i][j][k];
-                }
+    for (unsigned long int n = 0; n < val.size(); n++)
+        if (v[n] > max) {
+            max = v[n];
+        }
 
     return max;
 }
 
 double Dose::getMinMaxAvg(double *min, double *max, double *avg) {
+    const DoseReal *v = val.data();
     *min = *max = *avg = 0;
     int flag = 0;
 
     // Iterate through all dose to get largest and smallest dose
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++)
-                if (val[i][j][k] == val[i][j][k]) { // Will return false if NaN
-                    if (!flag++) {
-                        *min = val[i][j][k];
-                        *max = val[i][j][k];
-                    }
-                    else if (val[i][j][k] < *min) {
-                        *min = val[i][j][k];
-                    }
-                    else if (val[i][j][k] > *max) {
-                        *max = val[i][j][k];
-                    }
-                    *avg += val[i][j][k];
-                }
+    for (unsigned long int n = 0; n < val.size(); n++)
+        if (v[n] == v[n]) { // Will return false if NaN
+            if (!flag++) {
+                *min = v[n];
+                *max = v[n];
+            }
+            else if (v[n] < *min) {
+                *min = v[n];
+            }
+            else if (v[n] > *max) {
+                *max = v[n];
+            }
+            *avg += v[n];
+        }
 
     *avg /= flag;
     return *avg;
@@ -1032,24 +1041,24 @@ double Dose::getMinMaxAvg(double *min, double *max, double *avg, double xi,
     int flag = 0;
 
     // Iterate through all dose to get largest and smallest dose
-    for (int k = 0; k < val[0][0].size(); k++)
-        for (int j = 0; j < val[0].size(); j++)
-            for (int i = 0; i < val.size(); i++)
-                if (val[i][j][k] == val[i][j][k]) // Will return false if NaN
+    for (int k = 0; k < z; k++)
+        for (int j = 0; j < y; j++)
+            for (int i = 0; i < x; i++)
+                if (val(i,j,k) == val(i,j,k)) // Will return false if NaN
                     if ((cx[i+1]+cx[i])/2.0 > xi && (cx[i+1]+cx[i])/2.0 < xf &&
                             (cy[j+1]+cy[j])/2.0 > yi && (cy[j+1]+cy[j])/2.0 < yf &&
                             (cz[k+1]+cz[k])/2.0 > zi && (cz[k+1]+cz[k])/2.0 < zf) {
                         if (!flag++) {
-                            *min = val[i][j][k];
-                            *max = val[i][j][k];
+                            *min = val(i,j,k);
+                            *max = val(i,j,k);
                         }
-                        else if (val[i][j][k] < *min) {
-                            *min = val[i][j][k];
+                        else if (val(i,j,k) < *min) {
+                            *min = val(i,j,k);
                         }
-                        else if (val[i][j][k] > *max) {
-                            *max = val[i][j][k];
+                        else if (val(i,j,k) > *max) {
+                            *max = val(i,j,k);
                         }
-                        *avg += val[i][j][k];
+                        *avg += val(i,j,k);
                     }
 
     *avg /= flag;
@@ -1057,30 +1066,32 @@ double Dose::getMinMaxAvg(double *min, double *max, double *avg, double xi,
 }
 
 void Dose::square() {
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                err[i][j][k] *= 2*val[i][j][k]; // adjust error
-                val[i][j][k] *= val[i][j][k]; // square each value
-            }
+    DoseReal *v = val.data(), *e = err.data();
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        if (e != NULL)
+            e[n] *= 2*v[n]; // adjust error
+        v[n] *= v[n]; // square each value
+    }
 }
 
 void Dose::root() {
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                val[i][j][k] = sqrt(val[i][j][k]); // root each value
-                err[i][j][k] /= 2*val[i][j][k]; // adjust error
-            }
+    DoseReal *v = val.data(), *e = err.data();
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        v[n] = sqrt(v[n]); // root each value
+        if (e != NULL)
+            e[n] /= 2*v[n]; // adjust error
+    }
 }
 
 void Dose::scaleError() {
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                val[i][j][k] /= err[i][j][k]; // divide each value by error
-                err[i][j][k] = 1; // adjust error (to be 1)
-            }
+    DoseReal *v = val.data(), *e = err.data();
+    if (e == NULL) // Without errors, every error is 0
+        return;
+
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        v[n] /= e[n]; // divide each value by error
+        e[n] = 1; // adjust error (to be 1)
+    }
 }
 
 int Dose::scale(double factor) {
@@ -1088,11 +1099,10 @@ int Dose::scale(double factor) {
         return 0;
     }
 
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                val[i][j][k] *= factor;    // multiply each value by factor
-            }
+    DoseReal *v = val.data();
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        v[n] *= factor;    // multiply each value by factor
+    }
 
     // Since error is fractional, it does not change
 
@@ -1112,11 +1122,10 @@ int Dose::scaleAtPoint(double px, double py, double pz, double goal, char doTri)
     // at the position has goal dose, and each other voxel is scaled appropriately
 
     double factor = goal/value;
-    for (int k = 0; k < z; k++)
-        for (int j = 0; j < y; j++)
-            for (int i = 0; i < x; i++) {
-                val[i][j][k] *= factor;
-            }
+    DoseReal *v = val.data();
+    for (unsigned long int n = 0; n < val.size(); n++) {
+        v[n] *= factor;
+    }
 
     // Since error is fractional, it does not change
 
@@ -1133,8 +1142,8 @@ int Dose::scaleAverage() {
                 // volume (same for error using root squared) to find the total
                 // dose in the volume, same for error but in quadrature
                 volume = (cx[i+1]-cx[i])*(cy[j+1]-cy[j])*(cz[k+1]-cz[k]);
-                factor += val[i][j][k]*volume;
-                error = sqrt(pow(err[i][j][k]*val[i][j][k]*volume, 2) +
+                factor += val(i,j,k)*volume;
+                error = sqrt(pow(getError(i,j,k)*val(i,j,k)*volume, 2) +
                              pow(error, 2));
             }
 
@@ -1150,10 +1159,11 @@ int Dose::scaleAverage() {
                 // Then divide by the average dose per volume times the volume
                 // of the voxel
                 volume = (cx[i+1]-cx[i])*(cy[j+1]-cy[j])*(cz[k+1]-cz[k]);
-                val[i][j][k] /= (factor*volume);
+                val(i,j,k) /= (factor*volume);
                 // Then propagate error
-                err[i][j][k] = sqrt(pow(err[i][j][k], 2) +
-                                    pow(error*volume, 2));
+                if (!err.isEmpty())
+                    err(i,j,k) = sqrt(pow(err(i,j,k), 2) +
+                                      pow(error*volume, 2));
             }
 
     return 1;
@@ -1167,25 +1177,26 @@ int Dose::scaleArea(double ix, double iy, double iz, double fx, double fy,
 
     double factor = 0, error = 0;
     // Get indeces
-    int xmax = getIndex("X", fx);
-    int ymax = getIndex("Y", fy);
-    int zmax = getIndex("Z", fz);
+    int xmax = getIndex(XAxis, fx);
+    int ymax = getIndex(YAxis, fy);
+    int zmax = getIndex(ZAxis, fz);
 
     // Find the largest dose within the defined volume
-    for (int k = getIndex("Z", iz); k <= zmax; k++)
-        for (int j = getIndex("Y", iy); j <= ymax; j++)
-            for (int i = getIndex("X", ix); i <= xmax; i++)
-                if (val[i][j][k] > factor) {
-                    factor = val[i][j][k];
-                    error = err[i][j][k];
+    for (int k = getIndex(ZAxis, iz); k <= zmax; k++)
+        for (int j = getIndex(YAxis, iy); j <= ymax; j++)
+            for (int i = getIndex(XAxis, ix); i <= xmax; i++)
+                if (val(i,j,k) > factor) {
+                    factor = val(i,j,k);
+                    error = getError(i,j,k);
                 }
 
     // And factor all values by it
     for (int k = 0; k < z; k++)
         for (int j = 0; j < y; j++)
             for (int i = 0; i < x; i++) {
-                val[i][j][k] /= factor;
-                err[i][j][k] = sqrt(pow(err[i][j][k], 2) + pow(error, 2));
+                val(i,j,k) /= factor;
+                if (!err.isEmpty())
+                    err(i,j,k) = sqrt(pow(err(i,j,k), 2) + pow(error, 2));
             }
 
     return 1;
@@ -1208,15 +1219,15 @@ QString Dose::plot(QString axis, double a, double b, double start, double stop)
         if (final == -1) {
             final = x-1;
         }
-        one = getIndex("Y", a);
-        two = getIndex("Z", b);
+        one = getIndex(YAxis, a);
+        two = getIndex(ZAxis, b);
         output += "x (cm)" + delimiter + "dose" + delimiter + "error\n";
         for (int i = initial; i <= final; i++) {
             output += QString::number((cx[i]+cx[i+1])/2.0, 'E', 4);
             output += delimiter;
-            output += QString::number(val[i][one][two], 'E', 4);
+            output += QString::number(val(i,one,two), 'E', 4);
             output += delimiter;
-            output += QString::number(err[i][one][two]*val[i][one][two],
+            output += QString::number(getError(i,one,two)*val(i,one,two),
                                       'E', 4);
             output += "\n";
         }
@@ -1230,15 +1241,15 @@ QString Dose::plot(QString axis, double a, double b, double start, double stop)
         if (final == -1) {
             final = y-1;
         }
-        one = getIndex("X", a);
-        two = getIndex("Z", b);
+        one = getIndex(XAxis, a);
+        two = getIndex(ZAxis, b);
         output += "y (cm)" + delimiter + "dose" + delimiter + "error\n";
         for (int i = initial+1; i <= final; i++) {
             output += QString::number((cy[i]+cy[i+1])/2.0, 'E', 4);
             output += delimiter;
-            output += QString::number(val[one][i][two], 'E', 4);
+            output += QString::number(val(one,i,two), 'E', 4);
             output += delimiter;
-            output += QString::number(err[one][i][two]*val[one][i][two],
+            output += QString::number(getError(one,i,two)*val(one,i,two),
                                       'E', 4);
             output += "\n";
         }
@@ -1252,15 +1263,15 @@ QString Dose::plot(QString axis, double a, double b, double start, double stop)
         if (final == -1) {
             final = z-1;
         }
-        one = getIndex("X", a);
-        two = getIndex("Y", b);
+        one = getIndex(XAxis, a);
+        two = getIndex(YAxis, b);
         output += "z (cm)" + delimiter + "dose" + delimiter + "error\n";
         for (int i = initial; i <= final; i++) {
             output += QString::number((cz[i]+cz[i+1])/2.0, 'E', 4);
             output += delimiter;
-            output += QString::number(val[one][two][i], 'E', 4);
+            output += QString::number(val(one,two,i), 'E', 4);
             output += delimiter;
-            output += QString::number(err[one][two][i]*val[one][two][i],
+            output += QString::number(getError(one,two,i)*val(one,two,i),
                                       'E', 4);
             output += "\n";
         }
@@ -1428,56 +1439,28 @@ void Dose::getContour(QVector <QVector <QLineF> > *con,
 
     px.clear();
     py.clear();
-    // Setup dose and pixel arrays
-    if (!axis.compare("X")) {
-        for (int i = 0; i < y; i++)
-            if (cy[i] > bi && cy[i+1] < bf) {
-                px.append(int(((cy[i]+cy[i+1])/2.0-bi)*double(res)));
-                temp.clear();
-                for (int j = 0; j < z; j++)
-                    if (cz[j] > ai && cz[j+1] < af) {
-                        temp.append(val[n][i][j]);
-                        if (!flag)
-                            py.append(int(((cz[j]+cz[j+1])/2.0-ai)
-                                          *double(res)));
-                    }
-                flag++;
-                d.append(temp);
-            }
-    }
-    else if (!axis.compare("Y")) {
-        for (int i = 0; i < x; i++)
-            if (cx[i] > bi && cx[i+1] < bf) {
-                px.append(int(((cx[i]+cx[i+1])/2.0-bi)*double(res)));
-                temp.clear();
-                for (int j = 0; j < z; j++)
-                    if (cz[j] > ai && cz[j+1] < af) {
-                        temp.append(val[i][n][j]);
-                        if (!flag)
-                            py.append(int(((cz[j]+cz[j+1])/2.0-ai)
-                                          *double(res)));
-                    }
-                flag++;
-                d.append(temp);
-            }
-    }
-    else if (!axis.compare("Z")) {
-        for (int i = 0; i < x; i++)
-            if (cx[i] > bi && cx[i+1] < bf) {
-                px.append(int(((cx[i]+cx[i+1])/2.0-bi)*double(res)));
-                temp.clear();
-                for (int j = 0; j < y; j++)
-                    if (cy[j] > ai && cy[j+1] < af) {
-                        temp.append(val[i][j][n]);
-                        if (!flag)
-                            py.append(int(((cy[j]+cy[j+1])/2.0-ai)
-                                          *double(res)));
-                    }
-                flag++;
-                d.append(temp);
-            }
-    }
-
+    // Setup dose and pixel arrays from the whole plane, copied out once, with
+    // a running along the first remaining axis and b along the second
+    Axis ax = !axis.compare("X") ? XAxis : (!axis.compare("Y") ? YAxis : ZAxis);
+    const QVector <double> &ca = ax == XAxis ? cy : cx;
+    const QVector <double> &cb = ax == ZAxis ? cy : cz;
+    QVector <DoseReal> plane;
+    getPlane(ax, n, &plane);
+    int na = ca.size()-1, nb = cb.size()-1;
+    for (int i = 0; i < na; i++)
+        if (ca[i] > bi && ca[i+1] < bf) {
+            px.append(int(((ca[i]+ca[i+1])/2.0-bi)*double(res)));
+            temp.clear();
+            for (int j = 0; j < nb; j++)
+                if (cb[j] > ai && cb[j+1] < af) {
+                    temp.append(plane[j*na+i]);
+                    if (!flag)
+                        py.append(int(((cb[j]+cb[j+1])/2.0-ai)
+                                      *double(res)));
+                }
+            flag++;
+            d.append(temp);
+        }
 
     for (int i = 0; i < px.size()-1; i++)
         for (int j = 0; j < py.size()-1; j++)
@@ -21,6 +21,17 @@
 #include <math.h>
 #include <string.h>
 #include <chrono>
+#include "volume.h"
+#include "grid.h"
+#include "resample.h"
+
+// Doses and errors are stored as floats when built with DOSE_SINGLE_PRECISION,
+// which halves the memory large dose grids need, files always hold doubles
+#ifdef DOSE_SINGLE_PRECISION
+typedef float DoseReal;
+#else
+typedef double DoseReal;
+#endif
 
 // This structure holds a dose and a volume, this is essentially a point on a
 // DVH, and I made it a struct for minimal overhead
@@ -46,8 +57,10 @@ public:
 
     int x, y, z; // The number of x, y and z voxels
     QVector <double> cx, cy, cz; // The actual x, y and z coordinates
-    QVector < QVector < QVector <double> > > val; // The values
-    QVector < QVector < QVector <double> > > err; // The fractional errors
+    GridAxis gx, gy, gz; // Voxel lookup along cx, cy and cz, see updateGrid
+    Volume <DoseReal> val; // The values
+    Volume <DoseReal> err; // The fractional errors, empty if keepError is false
+    bool keepError; // Set to false before reading to skip the errors entirely
     char filled; // Flag that says if the dose file is empty of not
 
     // Interpolate lineary at a point ap between a0 and a1 (which have dose b0
@@ -101,8 +114,20 @@ public:
     // Remove the outer layers of voxels
     int strip();
 
+    // Move this onto the grid with boundaries bx, by and bz, Overlap keeps
+    // the integral dose
+    int resample(const QVector <double> &bx, const QVector <double> &by,
+                 const QVector <double> &bz, Resampler::Mode mode);
+
     // Returns the index of the coordinate matrix at val
     int getIndex(QString axis, double val);
+    int getIndex(Axis axis, double p);
+
+    // Rebuild gx, gy and gz, needed whenever cx, cy or cz are changed by hand
+    void updateGrid();
+
+    // Plane n of val along axis, laid out as described for extractPlane
+    void getPlane(Axis axis, int n, QVector <DoseReal> *out);
 
     // These functions return dose at a point in real space or at an index
     double getDose(double px, double py, double pz);
@@ -161,6 +186,10 @@ public:
 
     // Progress bar resolution
     const static int MAX_PROGRESS = 1000000000;
+
+private:
+    void failText(QString path, QString section);
+    int allocate(QString path);
 };
 
 /*******************************************************************************
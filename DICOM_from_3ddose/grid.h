@@ -0,0 +1,99 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef GRID_H
+#define GRID_H
+
+#include <QtCore>
+#include <algorithm>
+#include <math.h>
+
+enum Axis {XAxis, YAxis, ZAxis};
+
+// Finds the voxel holding a coordinate along one axis of a grid, given the n+1
+// voxel boundaries, in constant time when the voxels are all the same size and
+// by binary search otherwise
+class GridAxis {
+public:
+    GridAxis() {
+        n = 0;
+        uniform = false;
+        lo = hi = invStep = 0;
+    }
+
+    // Must be called again whenever the boundaries change
+    void build(const QVector <double> &bounds) {
+        b = bounds;
+        n = b.size()-1;
+        uniform = false;
+        if (n < 1) {
+            n = 0;
+            return;
+        }
+        lo = b[0];
+        hi = b[n];
+        invStep = n/(hi-lo);
+
+        // Allow for the rounding of boundaries read from text files
+        double step = (hi-lo)/n;
+        uniform = step > 0;
+        for (int i = 1; i < n && uniform; i++)
+            if (fabs(b[i]-(lo+i*step)) > 1e-6*step)
+                uniform = false;
+    }
+
+    // The voxel i for which b[i] <= p < b[i+1], or -1 outside the grid
+    inline int lower(double p) const {
+        if (n == 0 || !(p >= lo) || p >= hi)
+            return -1;
+        return find(p);
+    }
+
+    // The voxel i for which b[i] < p <= b[i+1], counting b[0] as part of
+    // voxel 0, or -1 outside the grid
+    inline int upper(double p) const {
+        if (n == 0 || !(p >= lo) || p > hi)
+            return -1;
+        if (p == lo)
+            return 0;
+        int i = p == hi ? n-1 : find(p);
+        return p == b[i] ? i-1 : i;
+    }
+
+    inline int size() const {return n;}
+    inline bool isUniform() const {return uniform;}
+
+private:
+    QVector <double> b;
+    int n;
+    bool uniform;
+    double lo, hi, invStep;
+
+    // b[i] <= p < b[i+1] for lo <= p < hi
+    inline int find(double p) const {
+        if (!uniform)
+            return int(std::upper_bound(b.constBegin(), b.constEnd(), p)-b.constBegin())-1;
+
+        // The guess can only be off by one because of rounding
+        int i = int((p-lo)*invStep);
+        i = i < 0 ? 0 : (i >= n ? n-1 : i);
+        while (i > 0 && p < b[i])
+            i--;
+        while (i < n-1 && p >= b[i+1])
+            i++;
+        return i;
+    }
+};
+
+#endif
@@ -0,0 +1,114 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "resample.h"
+
+Resampler::Resampler(Mode m) {
+    mode = m;
+}
+
+void Resampler::setGrids(const QVector <double> &sx, const QVector <double> &sy, const QVector <double> &sz,
+                         const QVector <double> &tx, const QVector <double> &ty, const QVector <double> &tz) {
+    ax = buildAxis(sx, tx, mode);
+    ay = buildAxis(sy, ty, mode);
+    az = buildAxis(sz, tz, mode);
+}
+
+ResampleAxis Resampler::buildAxis(const QVector <double> &src, const QVector <double> &dst, Mode mode) {
+    ResampleAxis axis;
+    int n = src.size()-1, m = dst.size()-1;
+    if (m < 1)
+        return axis;
+    axis.start.fill(0, m+1);
+    if (n < 1)
+        return axis;
+
+    GridAxis grid;
+    grid.build(src);
+    QVector <double> c(n); // Source voxel centers
+    for (int i = 0; i < n; i++)
+        c[i] = (src[i]+src[i+1])/2.0;
+
+    int index[4];
+    double weight[4];
+    for (int i = 0; i < m; i++) {
+        axis.start[i] = axis.index.size();
+
+        if (mode == Overlap) {
+            // Every source voxel overlapping [a,b] by the fraction it covers
+            double a = dst[i], b = dst[i+1], overlap;
+            int s = int(std::upper_bound(src.constBegin(), src.constEnd(), a)-src.constBegin())-1;
+            for (s = s < 0 ? 0 : s; s < n && src[s] < b; s++) {
+                overlap = (src[s+1] < b ? src[s+1] : b)-(src[s] > a ? src[s] : a);
+                if (overlap > 0) {
+                    axis.index.append(s);
+                    axis.weight.append(overlap/(b-a));
+                }
+            }
+            continue;
+        }
+
+        double p = (dst[i]+dst[i+1])/2.0;
+        int v = grid.upper(p);
+        if (v < 0)
+            continue; // Outside the source, so there is nothing to add up
+
+        int taps = 1;
+        if (mode == Nearest) {
+            index[0] = v;
+            weight[0] = 1;
+        }
+        else {
+            // Find the source centers on either side of p, between an outer
+            // boundary and the outer center the edge voxel is used as is
+            int i0 = p < c[v] ? v-1 : v;
+            double t = 0;
+            if (i0 < 0)
+                i0 = 0;
+            else if (i0 >= n-1)
+                i0 = n-1;
+            else
+                t = (p-c[i0])/(c[i0+1]-c[i0]);
+
+            if (mode == Trilinear) {
+                taps = 2;
+                index[0] = i0;
+                index[1] = i0+1 < n ? i0+1 : i0;
+                weight[0] = 1-t;
+                weight[1] = t;
+            }
+            else {
+                // Catmull-Rom weights over the centers i0-1 to i0+2, repeating
+                // the edge voxels past the ends
+                taps = 4;
+                for (int l = 0; l < 4; l++) {
+                    int s = i0-1+l;
+                    index[l] = s < 0 ? 0 : (s > n-1 ? n-1 : s);
+                }
+                weight[0] = (-t*t*t + 2*t*t - t)/2.0;
+                weight[1] = (3*t*t*t - 5*t*t + 2)/2.0;
+                weight[2] = (-3*t*t*t + 4*t*t + t)/2.0;
+                weight[3] = (t*t*t - t*t)/2.0;
+            }
+        }
+
+        for (int l = 0; l < taps; l++)
+            if (weight[l] != 0) {
+                axis.index.append(index[l]);
+                axis.weight.append(weight[l]);
+            }
+    }
+    axis.start[m] = axis.index.size();
+    return axis;
+}
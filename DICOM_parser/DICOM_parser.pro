@@ -2,7 +2,7 @@
 # Automatically generated by qmake (3.1) Wed Nov 4 11:41:04 2020
 ######################################################################
 
-QT+=widgets
+QT+=widgets concurrent
 TEMPLATE = app
 TARGET = DICOM_parser
 INCLUDEPATH += .
@@ -19,5 +19,5 @@ DEFINES += QT_DEPRECATED_WARNINGS
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
 # Input
-HEADERS += DICOM.h
-SOURCES += database.cpp DICOM.cpp main.cpp
+HEADERS += DICOM.h rewrite.h
+SOURCES += database.cpp DICOM.cpp query.cpp writer.cpp rewrite.cpp main.cpp
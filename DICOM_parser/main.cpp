@@ -1,4 +1,17 @@
 #include "DICOM.h"
+#include "rewrite.h"
+#include <QtConcurrent>
+
+// One file of a parallel rewrite
+struct RewriteJob {
+	Rewriter *rewriter;
+	QString in, out;
+	int ok;
+};
+
+void runRewriteJob(RewriteJob &job) {
+	job.ok = job.rewriter->rewrite(job.in, job.out);
+}
 
 double interp(double x, double x1, double x2, double y1, double y2) {
 	return (y2*(x-x1)+y1*(x2-x))/(x2-x1);
@@ -71,17 +84,92 @@ int main(int argc, char **argv) {
     start = std::clock();
 	
 	if (argc == 1) {
-        std::cout << "Please call this program with one or more .dcm files.\n";
+        std::cout << "Please call this program with one or more .dcm files (- reads one from stdin).\n";
+        std::cout << "Add \"rules=FILE\" and \"out=DIRECTORY\" to rewrite the files with the rules in FILE instead,\n";
+        std::cout << "and \"key=SECRET\" to key the HMAC of any hash rules (or give it as a \"key SECRET\" line of FILE).\n";
         return 0;
     }
 
     database dat;
     QVector <DICOM *> dicom;
-
+	
+	// Look for the rewrite options first
+	QString rules = "", outDir = "", key = "";
+	QStringList files;
     for (int i = 0; i < argc-1; i++) {
         QString path(argv[i+1]);
+		if (!path.left(6).compare("rules="))
+			rules = path.right(path.size()-6);
+		else if (!path.left(4).compare("out="))
+			outDir = path.right(path.size()-4);
+		else if (!path.left(4).compare("key="))
+			key = path.right(path.size()-4);
+		else
+			files << path;
+	}
+	
+	// ---------------------------------------------------------- //
+	// REWRITE MODE                                               //
+	// ---------------------------------------------------------- //
+	/*
+	Every file is copied to the out directory with the rules
+	applied, and all the files are done in parallel.  Nothing is
+	parsed beyond what the rules need, untouched values (pixel
+	data especially) are written straight from the mapped input.
+	Hash rules are keyed HMACs, and need key=SECRET or a key line
+	in the rule file.
+	*/
+	if (!rules.isEmpty()) {
+		if (outDir.isEmpty()) {
+			std::cout << "Rewriting needs an output directory given by \"out=DIRECTORY\", quitting...\n";
+			return -1;
+		}
+		
+		Rewriter rewriter(&dat);
+		rewriter.key = key.toLatin1();
+		if (!rewriter.loadRules(rules))
+			return -1;
+		
+		QDir dir(outDir);
+		dir.mkpath(".");
+		QVector <RewriteJob> jobs(files.size());
+		for (int i = 0; i < files.size(); i++) {
+			jobs[i].rewriter = &rewriter;
+			jobs[i].in = files[i];
+			jobs[i].out = dir.filePath(QFileInfo(files[i]).fileName());
+		}
+		
+		QtConcurrent::blockingMap(jobs, runRewriteJob);
+		
+		int failed = 0;
+		for (int i = 0; i < jobs.size(); i++)
+			if (!jobs[i].ok)
+				failed++;
+		
+		duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+		std::cout << "Rewrote " << jobs.size()-failed << " of the " << jobs.size() << " DICOM files.  Time elapsed is " << duration << " s.\n";
+		return failed ? -1 : 1;
+	}
+
+    for (int i = 0; i < files.size(); i++) {
+        QString path(files[i]);
         DICOM *d = new DICOM(&dat);
-        if (!d->parse(path)) {
+		
+		// Read straight from stdin, so piped objects never touch the disk
+		int parsed = 0;
+		if (!path.compare("-")) {
+			QFile in;
+			if (in.open(stdin, QIODevice::ReadOnly)) {
+				d->path = "stdin";
+				parsed = d->parse(&in);
+				in.close();
+			}
+		}
+		else {
+			parsed = d->parse(path);
+		}
+		
+        if (!parsed) {
             std::cout << "Unsuccessfully parsed " << path.toStdString() << ", quitting...\n";
             for (int j = 0; j < dicom.size(); j++) {
                 delete dicom[j];
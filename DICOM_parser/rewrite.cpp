@@ -0,0 +1,287 @@
+#include "rewrite.h"
+
+static inline unsigned short int readLE16(const unsigned char *p) {
+	return ((unsigned short int)(p[1]) << 8) + (unsigned short int)p[0];
+}
+
+static inline unsigned int readLE32(const unsigned char *p) {
+	return ((unsigned int)(p[3]) << 24) + ((unsigned int)(p[2]) << 16) +
+		   ((unsigned int)(p[1]) << 8) + (unsigned int)p[0];
+}
+
+// Length of a text value without its padding
+static unsigned long int trimmedLength(const unsigned char *buf, unsigned long int n) {
+	while (n > 0 && (buf[n-1] == ' ' || buf[n-1] == '\0'))
+		n--;
+	return n;
+}
+
+Rewriter::Rewriter(database *l) {
+	lib = l;
+}
+
+int Rewriter::loadRules(QString p) {
+	QFile file(p);
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+		std::cout << "Could not open rule file " << p.toStdString() << ", quitting...\n";
+		return 0;
+	}
+
+	QTextStream input(&file);
+	QString line;
+	QStringList parts;
+	RewriteRule rule;
+	bool ok1, ok2, hashing = false;
+	while (!input.atEnd()) {
+		line = input.readLine().trimmed();
+		if (line.isEmpty() || line.startsWith("#"))
+			continue;
+
+		// key SECRET
+		if (line.startsWith("key ")) {
+			if (key.isEmpty())
+				key = line.mid(4).trimmed().toLatin1();
+			continue;
+		}
+
+		// gggg,eeee action [value]
+		parts = line.split(' ', QString::SkipEmptyParts);
+		if (parts.size() < 2 || parts[0].split(',').size() != 2) {
+			std::cout << "Could not read rule \"" << line.toStdString() << "\", quitting...\n";
+			return 0;
+		}
+		rule.tag[0] = parts[0].split(',')[0].toUShort(&ok1, 16);
+		rule.tag[1] = parts[0].split(',')[1].toUShort(&ok2, 16);
+
+		if (!parts[1].compare("remove")) {
+			rule.action = RewriteRule::Remove;
+		}
+		else if (!parts[1].compare("hash")) {
+			rule.action = RewriteRule::Hash;
+			hashing = true;
+		}
+		else if (!parts[1].compare("replace")) {
+			// The value is everything after the action, spaces and all
+			rule.action = RewriteRule::Replace;
+			rule.value = line.mid(line.indexOf("replace")+7).trimmed().toLatin1();
+		}
+		else {
+			ok1 = false;
+		}
+
+		if (!ok1 || !ok2) {
+			std::cout << "Could not read rule \"" << line.toStdString() << "\", quitting...\n";
+			return 0;
+		}
+		// Refuse to hash anything the dictionary says cannot hold a hash
+		if (rule.action == RewriteRule::Hash) {
+			Reference nearest = lib->binSearch(rule.tag[0], rule.tag[1], 0, lib->lib.size()-1);
+			if (nearest.tag[0] == rule.tag[0] && nearest.tag[1] == rule.tag[1] && !canHash(nearest.vr)) {
+				std::cout << "Cannot hash " << parts[0].toStdString() << ", which has VR " << nearest.vr.toStdString()
+						  << ", use remove or replace instead, quitting...\n";
+				return 0;
+			}
+		}
+		rules[((unsigned int)rule.tag[0] << 16) + rule.tag[1]] = rule;
+	}
+	file.close();
+
+	if (hashing && key.isEmpty()) {
+		std::cout << "Hash rules need a secret given by a \"key SECRET\" line or \"key=SECRET\", quitting...\n";
+		return 0;
+	}
+	return 1;
+}
+
+// UIDs, and text VRs which allow the 16 uppercase hex characters of a hash
+bool Rewriter::canHash(QString VR) {
+	static const char *hashable[] = {"UI", "AE", "CS", "LO", "LT", "PN", "SH", "ST", "UC", "UT"};
+	for (int i = 0; i < 10; i++)
+		if (!VR.compare(hashable[i]))
+			return true;
+	return false;
+}
+
+// Hashed values are the same in every file with the same key, so references
+// between objects still line up, UIDs become 2.25 (UUID derived) UIDs and
+// everything else hex
+QByteArray Rewriter::hashValue(const unsigned char *buf, unsigned long int n, QString VR) {
+	QByteArray digest = QMessageAuthenticationCode::hash(QByteArray((const char*)buf, trimmedLength(buf, n)),
+														 key, QCryptographicHash::Sha256);
+	if (!VR.compare("UI")) {
+		quint64 number = 0;
+		for (int i = 0; i < 8; i++)
+			number = (number << 8) + (unsigned char)digest[i];
+		return "2.25." + QByteArray::number(number);
+	}
+	return digest.toHex().left(16).toUpper();
+}
+
+int Rewriter::rewrite(QString in, QString out) {
+	QFile file(in);
+	if (!file.open(QIODevice::ReadOnly)) {
+		std::cout << "Could not open " << in.toStdString() << ", quitting...\n";
+		return 0;
+	}
+
+	// Map the input, values are written out straight from the mapping
+	unsigned long int n = file.size();
+	unsigned char *map = file.map(0, n);
+	QByteArray bytes;
+	const unsigned char *buf = map;
+	if (map == NULL) {
+		bytes = file.readAll();
+		buf = (const unsigned char*)(bytes.constData());
+		n = bytes.size();
+	}
+
+	if (n < 132 || strncmp((const char*)buf+128, "DICM", 4)) {
+		std::cout << in.toStdString() << " is not a DICOM file, quitting...\n";
+		return 0;
+	}
+
+	// Find the transfer syntax in group 0002, which is always explicit VR
+	DICOM dicom(lib);
+	unsigned long int pos = 132, head, length;
+	while ((head = dicom.elementHeader(buf+pos, n-pos, &length)) && readLE16(buf+pos) == 0x0002 &&
+		   pos+head+length <= n) {
+		if (readLE16(buf+pos+2) == 0x0010) {
+			QString syntax = QString::fromLatin1((const char*)buf+pos+head, trimmedLength(buf+pos+head, length));
+			if (!syntax.compare("1.2.840.10008.1.2")) {
+				dicom.isImplicit = true;
+			}
+			else if (!syntax.compare("1.2.840.10008.1.2.2") || !syntax.compare("1.2.840.10008.1.2.1.99")) {
+				std::cout << in.toStdString() << " is big endian or deflated, which cannot be rewritten, quitting...\n";
+				return 0;
+			}
+		}
+		pos += head+length;
+	}
+
+	DICOMWriter writer(lib);
+	writer.preamble = QByteArray((const char*)buf, 128);
+	if (!writer.open(out, dicom.isImplicit))
+		return 0;
+
+	int ok = rewriteElements(&dicom, &writer, buf+132, n-132, dicom.isImplicit);
+	ok = writer.close() && ok;
+	if (map != NULL)
+		file.unmap(map);
+	file.close();
+
+	if (!ok)
+		std::cout << "Failed to rewrite " << in.toStdString() << "\n";
+	return ok;
+}
+
+// implicit is the VR encoding of buf, which is the transfer syntax's except
+// within an undefined length UN
+int Rewriter::rewriteElements(DICOM *dicom, DICOMWriter *writer, const unsigned char *buf, unsigned long int n, bool implicit) {
+	unsigned long int pos = 0, head, length, size, value;
+	unsigned short int g, e;
+	QString VR;
+
+	while (pos < n) {
+		head = dicom->elementHeader(buf+pos, n-pos, &length, implicit);
+		if (!head)
+			return 0;
+		if (length != (unsigned long int)0xFFFFFFFF)
+			size = head+length <= n-pos ? head+length : 0;
+		else
+			size = dicom->elementSize(buf+pos, n-pos, implicit);
+		if (!size)
+			return 0;
+
+		g = readLE16(buf+pos);
+		e = readLE16(buf+pos+2);
+		value = length != (unsigned long int)0xFFFFFFFF ? length : size-head;
+
+		// Group lengths are recalculated (0002) or dropped (everything else)
+		if (e == 0x0000) {
+			pos += size;
+			continue;
+		}
+
+		// Explicit VRs are in the header, implicit ones come from the dictionary
+		if (g == 0x0002 || !implicit) {
+			VR = QString(QChar(buf[pos+4]))+QChar(buf[pos+5]);
+		}
+		else {
+			Reference nearest = lib->binSearch(g, e, 0, lib->lib.size()-1);
+			VR = (nearest.tag[0] == g && nearest.tag[1] == e) ? nearest.vr : QString("UN");
+			if (length == (unsigned long int)0xFFFFFFFF && g != 0x7FE0)
+				VR = "SQ"; // Only sequences can have undefined length in implicit VR
+		}
+
+		unsigned int key = ((unsigned int)g << 16) + e;
+		if (rules.contains(key)) {
+			RewriteRule rule = rules.value(key);
+			if (rule.action == RewriteRule::Replace) {
+				if (!writer->writeElement(g, e, VR, (const unsigned char*)(rule.value.constData()), rule.value.size()))
+					return 0;
+			}
+			else if (rule.action == RewriteRule::Hash) {
+				if (!canHash(VR)) {
+					std::cout << "Cannot hash (" << QString::number(g, 16).toStdString() << ","
+							  << QString::number(e, 16).toStdString() << "), which has VR " << VR.toStdString() << "\n";
+					return 0;
+				}
+				QByteArray hash = hashValue(buf+pos+head, value, VR);
+				if (!writer->writeElement(g, e, VR, (const unsigned char*)(hash.constData()), hash.size()))
+					return 0;
+			}
+		}
+		else if (!VR.compare("SQ") || (!VR.compare("UN") && length == (unsigned long int)0xFFFFFFFF)) {
+			// Rules apply within sequences too, so go through every item, an
+			// undefined length UN is a sequence in implicit VR (PS3.5 6.2.2)
+			// and is written out as one
+			bool inner = implicit || !VR.compare("UN");
+			if (!writer->beginSequence(g, e))
+				return 0;
+
+			const unsigned char *seq = buf+pos+head;
+			unsigned long int seqPos = 0, itemSize, itemLength;
+			while (seqPos+8 <= value) {
+				if (readLE16(seq+seqPos) != 0xFFFE || readLE16(seq+seqPos+2) != 0xE000)
+					break; // sequence delimiter
+
+				itemLength = readLE32(seq+seqPos+4);
+				if (itemLength != (unsigned long int)0xFFFFFFFF) {
+					itemSize = 8+itemLength;
+				}
+				else {
+					itemSize = dicom->elementSize(seq+seqPos, value-seqPos, inner);
+					itemLength = itemSize-16;
+				}
+				if (!itemSize || itemSize > value-seqPos)
+					return 0;
+
+				if (!writer->beginItem() || !rewriteElements(dicom, writer, seq+seqPos+8, itemLength, inner) || !writer->endItem())
+					return 0;
+				seqPos += itemSize;
+			}
+
+			if (!writer->endSequence())
+				return 0;
+		}
+		else if (length == (unsigned long int)0xFFFFFFFF && g == 0x7FE0 && e == 0x0010) {
+			// Encapsulated pixel data, copied as is
+			if (!writer->writeRaw(g, buf+pos, size))
+				return 0;
+		}
+		else if (length == (unsigned long int)0xFFFFFFFF) {
+			// Nothing else can hide undecoded values from the rules
+			std::cout << "Cannot rewrite (" << QString::number(g, 16).toStdString() << ","
+					  << QString::number(e, 16).toStdString() << "), which has VR " << VR.toStdString() << " and undefined length\n";
+			return 0;
+		}
+		else {
+			// Untouched, straight from the input to the output
+			if (!writer->writeElement(g, e, VR, buf+pos+head, length))
+				return 0;
+		}
+
+		pos += size;
+	}
+	return 1;
+}
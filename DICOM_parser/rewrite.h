@@ -0,0 +1,50 @@
+#ifndef REWRITE_H
+#define REWRITE_H
+
+#include "DICOM.h"
+#include <string.h>
+
+// One line of a rule file, "gggg,eeee remove", "gggg,eeee replace VALUE" or
+// "gggg,eeee hash", rules apply at any depth within sequences
+//
+// Hashed values are an HMAC-SHA256 of the value keyed with the secret given
+// on a "key SECRET" line of the rule file or by "key=SECRET" (which wins),
+// hash rules are refused without one, as a plain hash of an MRN, name or date
+// is undone by hashing every candidate; only UI and the text VRs AE, CS, LO,
+// LT, PN, SH, ST, UC and UT can be hashed, dates, times, ages, numbers and
+// binary values have to be removed or replaced
+class RewriteRule {
+public:
+	enum Action {Remove, Replace, Hash};
+	
+    unsigned short int tag[2]; // Element Identifier
+	Action action;
+	QByteArray value; // Replacement value
+};
+
+// Copies DICOM files while applying a rule set, everything the rules do not
+// touch is written straight out of the mapped input without being decoded
+class Rewriter {
+public:
+    // Pointer to precompiled DICOM library
+    database *lib;
+	
+	// Rules keyed by (group << 16) + element
+	QMap <unsigned int, RewriteRule> rules;
+	
+	// The HMAC key for hash rules, a "key" line of the rule file only sets it
+	// if it is still empty
+	QByteArray key;
+	
+	Rewriter(database *l);
+	
+	int loadRules(QString p);
+	int rewrite(QString in, QString out); // Safe to call for many files at once
+	
+private:
+	int rewriteElements(DICOM *dicom, DICOMWriter *writer, const unsigned char *buf, unsigned long int n, bool implicit);
+	QByteArray hashValue(const unsigned char *buf, unsigned long int n, QString VR);
+	static bool canHash(QString VR);
+};
+
+#endif
@@ -2,7 +2,7 @@
 # Automatically generated by qmake (3.1) Wed May 6 14:49:07 2020
 ######################################################################
 
-QT+=widgets
+QT+=widgets concurrent
 TEMPLATE = app
 TARGET = DICOM_to_egsphant
 INCLUDEPATH += .
@@ -19,5 +19,5 @@ DEFINES += QT_DEPRECATED_WARNINGS
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
 # Input
-HEADERS += DICOM.h egsphant.h
-SOURCES += database.cpp DICOM.cpp egsphant.cpp main.cpp
+HEADERS += blockphant.h DICOM.h distance.h downsample.h egsphant.h grid.h mask.h merge.h projection.h resample.h sliceimage.h textnumber.h textreader.h volume.h voxelise.h
+SOURCES += database.cpp DICOM.cpp query.cpp writer.cpp blockphant.cpp distance.cpp downsample.cpp egsphant.cpp mask.cpp merge.cpp projection.cpp resample.cpp sliceimage.cpp textreader.cpp voxelise.cpp main.cpp
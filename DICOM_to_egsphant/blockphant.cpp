@@ -0,0 +1,341 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "blockphant.h"
+
+BlockPhant::BlockPhant() {
+    nx = ny = nz = 0;
+    bnx = bny = bnz = 0;
+    maxDensity = 0;
+}
+
+void BlockPhant::updateGrid() {
+    gx.build(x);
+    gy.build(y);
+    gz.build(z);
+}
+
+void BlockPhant::compress(EGSPhant *phant) {
+    nx = phant->nx; ny = phant->ny; nz = phant->nz;
+    x = phant->x; y = phant->y; z = phant->z;
+    media = phant->media;
+    maxDensity = phant->maxDensity;
+    updateGrid();
+
+    bnx = (nx+MASK) >> SHIFT; bny = (ny+MASK) >> SHIFT; bnz = (nz+MASK) >> SHIFT;
+    blocks.resize(bnx*bny*bnz);
+    mixedM.clear();
+    mixedD.clear();
+
+    int n = 0;
+    for (int bk = 0; bk < bnz; bk++) {
+        int k0 = bk << SHIFT, k1 = k0+BLOCK < nz ? k0+BLOCK : nz;
+        for (int bj = 0; bj < bny; bj++) {
+            int j0 = bj << SHIFT, j1 = j0+BLOCK < ny ? j0+BLOCK : ny;
+            for (int bi = 0; bi < bnx; bi++, n++) {
+                int i0 = bi << SHIFT, i1 = i0+BLOCK < nx ? i0+BLOCK : nx;
+
+                // Check the voxels against the first one
+                char medium = phant->m(i0,j0,k0);
+                double density = phant->d(i0,j0,k0);
+                bool uniform = true;
+                for (int k = k0; k < k1 && uniform; k++)
+                    for (int j = j0; j < j1 && uniform; j++) {
+                        const char *m = phant->m.row(j,k);
+                        const double *d = phant->d.row(j,k);
+                        for (int i = i0; i < i1; i++)
+                            if (m[i] != medium || d[i] != density) {
+                                uniform = false;
+                                break;
+                            }
+                    }
+
+                blocks[n].medium = medium;
+                blocks[n].density = density;
+                blocks[n].mixed = -1;
+                if (uniform)
+                    continue;
+
+                // Keep every voxel, those past the edge of the phantom take
+                // the first voxel's values
+                blocks[n].mixed = mixedM.size()/VOXELS;
+                int offset = mixedM.size();
+                mixedM.resize(offset+VOXELS);
+                mixedD.resize(offset+VOXELS);
+                for (int l = 0; l < VOXELS; l++) {
+                    mixedM[offset+l] = medium;
+                    mixedD[offset+l] = density;
+                }
+                for (int k = k0; k < k1; k++)
+                    for (int j = j0; j < j1; j++)
+                        for (int i = i0; i < i1; i++) {
+                            mixedM[offset+inner(i,j,k)] = phant->m(i,j,k);
+                            mixedD[offset+inner(i,j,k)] = phant->d(i,j,k);
+                        }
+            }
+        }
+    }
+}
+
+int BlockPhant::expand(EGSPhant *phant) {
+    phant->nx = nx; phant->ny = ny; phant->nz = nz;
+    phant->x = x; phant->y = y; phant->z = z;
+    phant->media = media;
+    phant->maxDensity = maxDensity;
+    phant->updateGrid();
+    if (!phant->m.resize(nx, ny, nz, 0) || !phant->d.resize(nx, ny, nz, 0)) {
+        phant->nx = phant->ny = phant->nz = 0;
+        phant->m.clear();
+        phant->d.clear();
+        return 0;
+    }
+
+    // Fill one row at a time, the blocks along it change every BLOCK voxels
+    for (int k = 0; k < nz; k++) {
+        for (int j = 0; j < ny; j++) {
+            char *m = phant->m.row(j,k);
+            double *d = phant->d.row(j,k);
+            for (int i0 = 0; i0 < nx; i0 += BLOCK) {
+                const PhantBlock &b = block(i0, j, k);
+                int i1 = i0+BLOCK < nx ? i0+BLOCK : nx;
+                if (b.mixed < 0) {
+                    memset(m+i0, b.medium, i1-i0);
+                    for (int i = i0; i < i1; i++)
+                        d[i] = b.density;
+                }
+                else {
+                    int offset = b.mixed*VOXELS+inner(i0, j, k);
+                    memcpy(m+i0, mixedM.constData()+offset, i1-i0);
+                    memcpy(d+i0, mixedD.constData()+offset, (i1-i0)*sizeof(double));
+                }
+            }
+        }
+        phant->m.release(k, k+1);
+        phant->d.release(k, k+1);
+    }
+    return 1;
+}
+
+char BlockPhant::getMedia(int i, int j, int k) const {
+    const PhantBlock &b = block(i, j, k);
+    return b.mixed < 0 ? b.medium : mixedM[b.mixed*VOXELS+inner(i, j, k)];
+}
+
+double BlockPhant::getDensity(int i, int j, int k) const {
+    const PhantBlock &b = block(i, j, k);
+    return b.mixed < 0 ? b.density : mixedD[b.mixed*VOXELS+inner(i, j, k)];
+}
+
+char BlockPhant::getMedia(double px, double py, double pz) const {
+    int ix = gx.upper(px), iy = gy.upper(py), iz = gz.upper(pz);
+    if (ix < 0 || iy < 0 || iz < 0)
+        return 0;
+    return getMedia(ix, iy, iz);
+}
+
+double BlockPhant::getDensity(double px, double py, double pz) const {
+    int ix = gx.upper(px), iy = gy.upper(py), iz = gz.upper(pz);
+    if (ix < 0 || iy < 0 || iz < 0)
+        return 0;
+    return getDensity(ix, iy, iz);
+}
+
+unsigned long int BlockPhant::countMedia(char medium) const {
+    unsigned long int total = 0;
+    int n = 0;
+    for (int bk = 0; bk < bnz; bk++) {
+        int k0 = bk << SHIFT, k1 = k0+BLOCK < nz ? k0+BLOCK : nz;
+        for (int bj = 0; bj < bny; bj++) {
+            int j0 = bj << SHIFT, j1 = j0+BLOCK < ny ? j0+BLOCK : ny;
+            for (int bi = 0; bi < bnx; bi++, n++) {
+                int i0 = bi << SHIFT, i1 = i0+BLOCK < nx ? i0+BLOCK : nx;
+                const PhantBlock &b = blocks[n];
+                if (b.mixed < 0) {
+                    if (b.medium == medium)
+                        total += (unsigned long int)(i1-i0)*(j1-j0)*(k1-k0);
+                    continue;
+                }
+
+                const char *m = mixedM.constData()+b.mixed*VOXELS;
+                for (int k = k0; k < k1; k++)
+                    for (int j = j0; j < j1; j++)
+                        for (int i = i0; i < i1; i++)
+                            if (m[inner(i, j, k)] == medium)
+                                total++;
+            }
+        }
+    }
+    return total;
+}
+
+int BlockPhant::selectMedia(char medium, Mask *out) const {
+    *out = Mask(nx, ny, nz);
+    int n = 0;
+    for (int bk = 0; bk < bnz; bk++) {
+        int k0 = bk << SHIFT, k1 = k0+BLOCK < nz ? k0+BLOCK : nz;
+        for (int bj = 0; bj < bny; bj++) {
+            int j0 = bj << SHIFT, j1 = j0+BLOCK < ny ? j0+BLOCK : ny;
+            for (int bi = 0; bi < bnx; bi++, n++) {
+                int i0 = bi << SHIFT, i1 = i0+BLOCK < nx ? i0+BLOCK : nx;
+                const PhantBlock &b = blocks[n];
+                if (b.mixed < 0 && b.medium != medium)
+                    continue; // Nothing to check in the whole block
+
+                const char *m = b.mixed < 0 ? NULL : mixedM.constData()+b.mixed*VOXELS;
+                for (int k = k0; k < k1; k++)
+                    for (int j = j0; j < j1; j++)
+                        for (int i = i0; i < i1; i++)
+                            if (m == NULL || m[inner(i, j, k)] == medium)
+                                out->set(i, j, k);
+            }
+        }
+
+        // A row of blocks spans whole slices, which are now finished
+        for (int k = k0; k < k1; k++)
+            out->compress(k);
+    }
+    return 1;
+}
+
+unsigned long int BlockPhant::memoryUsed() const {
+    return (unsigned long int)blocks.size()*sizeof(PhantBlock)+
+           (unsigned long int)mixedM.size()*(sizeof(char)+sizeof(double));
+}
+
+double BlockPhant::compressionRatio() const {
+    unsigned long int used = memoryUsed();
+    if (used == 0)
+        return 0;
+    return (unsigned long int)nx*ny*nz*(sizeof(char)+sizeof(double))/double(used);
+}
+
+int BlockPhant::uniformBlocks() const {
+    int total = 0;
+    for (int n = 0; n < blocks.size(); n++)
+        if (blocks[n].mixed < 0)
+            total++;
+    return total;
+}
+
+int BlockPhant::saveFile(QString path) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        std::cout << "Could not open " << path.toStdString() << " for writing, quitting...\n";
+        return 0;
+    }
+
+    QDataStream output(&file);
+    output.setByteOrder(QDataStream::LittleEndian);
+
+    // The same header as a begsphant file
+    output << media.size();
+    for (int i = 0; i < media.size(); i++)
+        output << media[i];
+    output << nx << ny << nz;
+    for (int i = 0; i <= nx; i++)
+        output << x[i];
+    for (int i = 0; i <= ny; i++)
+        output << y[i];
+    for (int i = 0; i <= nz; i++)
+        output << z[i];
+    output << maxDensity;
+
+    // then the blocks and the voxels of the mixed ones
+    output << blocks.size() << mixedM.size()/VOXELS;
+    for (int n = 0; n < blocks.size(); n++)
+        output << qint8(blocks[n].medium) << blocks[n].density << blocks[n].mixed;
+    output.writeRawData(mixedM.constData(), mixedM.size());
+    for (int n = 0; n < mixedD.size(); n++)
+        output << mixedD[n];
+
+    file.close();
+    if (output.status() != QDataStream::Ok || file.error() != QFileDevice::NoError) {
+        std::cout << "Could not write all of " << path.toStdString() << ", quitting...\n";
+        return 0;
+    }
+    return 1;
+}
+
+int BlockPhant::loadFile(QString path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        std::cout << "Could not open " << path.toStdString() << " for reading, quitting...\n";
+        return 0;
+    }
+
+    QDataStream input(&file);
+    input.setByteOrder(QDataStream::LittleEndian);
+
+    // Every count sizes an allocation, so check them before trusting them
+    int num;
+    input >> num;
+    if (input.status() != QDataStream::Ok || num < 0 || num > 255) {
+        std::cout << path.toStdString() << " does not hold a valid media count, quitting...\n";
+        return 0;
+    }
+    media.resize(num);
+    for (int i = 0; i < num; i++)
+        input >> media[i];
+    input >> nx >> ny >> nz;
+    if (input.status() != QDataStream::Ok || nx < 0 || ny < 0 || nz < 0) {
+        std::cout << path.toStdString() << " does not hold valid dimensions, quitting...\n";
+        return 0;
+    }
+    x.fill(0, nx+1);
+    y.fill(0, ny+1);
+    z.fill(0, nz+1);
+    for (int i = 0; i <= nx; i++)
+        input >> x[i];
+    for (int i = 0; i <= ny; i++)
+        input >> y[i];
+    for (int i = 0; i <= nz; i++)
+        input >> z[i];
+    input >> maxDensity;
+    updateGrid();
+
+    int numBlocks, numMixed;
+    input >> numBlocks >> numMixed;
+    bnx = (nx+MASK) >> SHIFT; bny = (ny+MASK) >> SHIFT; bnz = (nz+MASK) >> SHIFT;
+    if (input.status() != QDataStream::Ok || numMixed < 0 || numMixed > numBlocks ||
+        (qint64)numBlocks != (qint64)bnx*bny*bnz) {
+        std::cout << path.toStdString() << " does not have the blocks its dimensions need, quitting...\n";
+        return 0;
+    }
+
+    blocks.resize(numBlocks);
+    qint8 medium;
+    for (int n = 0; n < numBlocks; n++) {
+        input >> medium >> blocks[n].density >> blocks[n].mixed;
+        blocks[n].medium = medium;
+        if (blocks[n].mixed < -1 || blocks[n].mixed >= numMixed) {
+            std::cout << path.toStdString() << " has a block outside its mixed voxels, quitting...\n";
+            return 0;
+        }
+    }
+    mixedM.resize(numMixed*VOXELS);
+    mixedD.resize(numMixed*VOXELS);
+    if (input.readRawData(mixedM.data(), mixedM.size()) != mixedM.size()) {
+        std::cout << path.toStdString() << " ended early, quitting...\n";
+        return 0;
+    }
+    for (int n = 0; n < mixedD.size(); n++)
+        input >> mixedD[n];
+
+    file.close();
+    if (input.status() != QDataStream::Ok) {
+        std::cout << path.toStdString() << " ended early, quitting...\n";
+        return 0;
+    }
+    return 1;
+}
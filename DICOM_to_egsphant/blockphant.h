@@ -0,0 +1,85 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef BLOCKPHANT_H
+#define BLOCKPHANT_H
+
+#include "egsphant.h"
+#include "mask.h"
+
+// One 8x8x8 block of a BlockPhant, a single medium and density if the whole
+// block is uniform, otherwise the index of its voxels in the mixed arrays
+struct PhantBlock {
+    char medium;
+    double density;
+    int mixed; // -1 for uniform blocks
+};
+
+// An egsphant stored as 8x8x8 blocks, where blocks holding one medium at one
+// density (the air around the patient, or tissue with nominal densities) are
+// kept as a single pair and only the other blocks keep all their voxels
+class BlockPhant {
+public:
+    enum {BLOCK = 8, SHIFT = 3, MASK = 7, VOXELS = 512};
+
+    BlockPhant();
+
+    int nx, ny, nz; // these hold the number of voxels
+    QVector <double> x, y, z; // these hold the boundaries of the above voxels
+    GridAxis gx, gy, gz; // these find voxels along x, y and z
+    QVector <QString> media; // this holds all the possible media
+    double maxDensity;
+
+    // Convert from and to the full grid, expand returns 0 and leaves phant
+    // empty if there is not enough memory
+    void compress(EGSPhant *phant);
+    int expand(EGSPhant *phant);
+
+    // Voxel queries, the ones by position give 0 outside the phantom
+    char getMedia(int i, int j, int k) const;
+    double getDensity(int i, int j, int k) const;
+    char getMedia(double px, double py, double pz) const;
+    double getDensity(double px, double py, double pz) const;
+
+    // The number of voxels of medium, and a mask of them, whole uniform blocks
+    // at a time
+    unsigned long int countMedia(char medium) const;
+    int selectMedia(char medium, Mask *out) const;
+
+    // Bytes of voxel data kept, and how many times less that is than the full
+    // grid needs
+    unsigned long int memoryUsed() const;
+    double compressionRatio() const;
+    int uniformBlocks() const;
+
+    // Binary files holding the blocks as they are kept here
+    int saveFile(QString path);
+    int loadFile(QString path);
+
+private:
+    int bnx, bny, bnz; // the number of blocks along each axis
+    QVector <PhantBlock> blocks; // x fastest, then y, then z
+    QVector <char> mixedM; // VOXELS media and densities per mixed block,
+    QVector <double> mixedD; // laid out x fastest within the block
+
+    inline const PhantBlock &block(int i, int j, int k) const {
+        return blocks[((k >> SHIFT)*bny+(j >> SHIFT))*bnx+(i >> SHIFT)];
+    }
+    inline static int inner(int i, int j, int k) {
+        return ((k & MASK) << (2*SHIFT)) | ((j & MASK) << SHIFT) | (i & MASK);
+    }
+    void updateGrid();
+};
+
+#endif
@@ -0,0 +1,207 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "distance.h"
+
+#define DISTANCE_FAR 1e30
+
+static void transformLinesJob(DistanceJob &job) {
+    job.transform->transformLines(job);
+}
+
+// The squared distance transform of the n samples f at positions p, into
+// out, v and z being space for the envelope
+static void envelope(const double *p, const double *f, int n, double *out, int *v, double *z) {
+    int k = -1;
+    double s;
+    for (int q = 0; q < n; q++) {
+        if (f[q] >= DISTANCE_FAR)
+            continue;
+
+        // Drop the parabolas this one is lower than everywhere they are lowest
+        while (k >= 0) {
+            s = ((f[q]+p[q]*p[q])-(f[v[k]]+p[v[k]]*p[v[k]]))/(2*(p[q]-p[v[k]]));
+            if (s > z[k])
+                break;
+            k--;
+        }
+        k++;
+        v[k] = q;
+        z[k] = k ? s : -DISTANCE_FAR;
+        z[k+1] = DISTANCE_FAR;
+    }
+
+    if (k < 0) {
+        for (int q = 0; q < n; q++)
+            out[q] = DISTANCE_FAR;
+        return;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; q++) {
+        while (z[k+1] < p[q])
+            k++;
+        out[q] = (p[q]-p[v[k]])*(p[q]-p[v[k]])+f[v[k]];
+    }
+}
+
+DistanceTransform::DistanceTransform(const QVector <double> &x, const QVector <double> &y, const QVector <double> &z) {
+    b[0] = x;
+    b[1] = y;
+    b[2] = z;
+    for (int l = 0; l < 3; l++) {
+        c[l].resize(b[l].size()-1);
+        for (int i = 0; i < c[l].size(); i++)
+            c[l][i] = (b[l][i]+b[l][i+1])/2.0;
+    }
+    nx = c[0].size();
+    ny = c[1].size();
+    nz = c[2].size();
+    vol = NULL;
+}
+
+void DistanceTransform::transformLines(DistanceJob &job) {
+    int n = job.axis == 0 ? nx : (job.axis == 1 ? ny : nz);
+    QVector <double> f(n), out(n), z(n+1);
+    QVector <int> v(n);
+    const double *p = c[job.axis].constData();
+
+    if (job.axis == 0) {
+        // The first pass starts from the mask itself, one row of slice k at
+        // a time
+        int k = job.n;
+        QVector <int> runs;
+        for (int j = 0; j < ny; j++) {
+            runs = job.mask->rowRuns(j, k);
+            f.fill(job.outside ? 0 : DISTANCE_FAR, nx);
+            for (int r = 0; r < runs.size(); r += 2)
+                for (int i = runs[r]; i < runs[r+1]; i++)
+                    f[i] = job.outside ? DISTANCE_FAR : 0;
+            envelope(p, f.constData(), nx, out.data(), v.data(), z.data());
+            float *row = vol->row(j,k);
+            for (int i = 0; i < nx; i++)
+                row[i] = out[i];
+        }
+    }
+    else if (job.axis == 1) {
+        // Columns of slice k
+        int k = job.n;
+        for (int i = 0; i < nx; i++) {
+            for (int j = 0; j < ny; j++)
+                f[j] = (*vol)(i,j,k);
+            envelope(p, f.constData(), ny, out.data(), v.data(), z.data());
+            for (int j = 0; j < ny; j++)
+                (*vol)(i,j,k) = out[j];
+        }
+    }
+    else {
+        // Lines through every slice, for row j
+        int j = job.n;
+        for (int i = 0; i < nx; i++) {
+            for (int k = 0; k < nz; k++)
+                f[k] = (*vol)(i,j,k);
+            envelope(p, f.constData(), nz, out.data(), v.data(), z.data());
+            for (int k = 0; k < nz; k++)
+                (*vol)(i,j,k) = out[k];
+        }
+    }
+}
+
+int DistanceTransform::squared(const Mask &mask, bool outside, Volume <float> *out) {
+    if (!out->resize(nx, ny, nz, 0))
+        return 0;
+    vol = out;
+
+    // x and y go a slice at a time, z a row of slices at a time
+    QVector <DistanceJob> jobs;
+    for (int axis = 0; axis < 3; axis++) {
+        jobs.resize(axis == 2 ? ny : nz);
+        for (int n = 0; n < jobs.size(); n++) {
+            jobs[n].transform = this;
+            jobs[n].mask = &mask;
+            jobs[n].outside = outside;
+            jobs[n].axis = axis;
+            jobs[n].n = n;
+        }
+        QtConcurrent::blockingMap(jobs, transformLinesJob);
+    }
+    vol = NULL;
+    return 1;
+}
+
+int DistanceTransform::signedDistance(const Mask &mask, Volume <float> *out) {
+    Volume <float> inside;
+    if (!squared(mask, false, out) || !squared(mask, true, &inside))
+        return 0;
+    for (int k = 0; k < nz; k++)
+        for (int j = 0; j < ny; j++) {
+            float *o = out->row(j,k);
+            const float *in = inside.row(j,k);
+            for (int i = 0; i < nx; i++)
+                o[i] = o[i] > 0 ? sqrt(o[i]) : -sqrt(in[i]);
+        }
+    return 1;
+}
+
+int DistanceTransform::grow(const Mask &mask, double margin, Mask *out) {
+    Volume <float> dist;
+    *out = Mask(nx, ny, nz);
+
+    // Growing keeps voxels within margin of the mask, shrinking keeps mask
+    // voxels more than -margin from the outside
+    if (!squared(mask, margin < 0, &dist))
+        return 0;
+    double limit = margin*margin*(1+1e-9);
+    for (int k = 0; k < nz; k++) {
+        for (int j = 0; j < ny; j++) {
+            const float *row = dist.row(j,k);
+            for (int i = 0; i < nx; i++)
+                if (margin < 0 ? row[i] > limit : row[i] <= limit)
+                    out->set(i,j,k);
+        }
+        out->compress(k);
+        dist.release(k, k+1);
+    }
+    return 1;
+}
+
+int DistanceTransform::save3ddose(QString path, const Volume <float> &values) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        std::cout << "Could not open " << path.toStdString() << " for writing, quitting...\n";
+        return 0;
+    }
+
+    // Laid out as Dose::readOut writes it
+    QTextStream output(&file);
+    output << nx << " " << ny << " " << nz << "\n";
+    for (int l = 0; l < 3; l++) {
+        for (int i = 0; i < b[l].size(); i++)
+            output << b[l][i] << " ";
+        output << "\n";
+    }
+    for (int k = 0; k < nz; k++)
+        for (int j = 0; j < ny; j++) {
+            const float *row = values.row(j,k);
+            for (int i = 0; i < nx; i++)
+                output << row[i] << " ";
+        }
+    output << "\n";
+    for (unsigned long int n = 0; n < (unsigned long int)nx*ny*nz; n++)
+        output << "0 ";
+    output << "\n\n";
+
+    file.close();
+    return 1;
+}
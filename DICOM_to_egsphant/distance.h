@@ -0,0 +1,66 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef DISTANCE_H
+#define DISTANCE_H
+
+#include <QtConcurrent>
+#include "mask.h"
+
+class DistanceTransform;
+
+// The lines along axis through slice n (x and y passes) or row n (z pass)
+struct DistanceJob {
+    DistanceTransform *transform;
+    const Mask *mask;
+    bool outside;
+    int axis, n;
+};
+
+// Exact Euclidean distance transforms over a grid of voxel boundaries x, y
+// and z, which need not be uniform, measured between voxel centers.  Each
+// pass along one axis takes the lower envelope of parabolas (Felzenszwalb and
+// Huttenlocher), so the whole transform is linear in the number of voxels,
+// and the lines of each pass are done in parallel
+class DistanceTransform {
+public:
+    DistanceTransform(const QVector <double> &x, const QVector <double> &y, const QVector <double> &z);
+
+    int nx, ny, nz; // these hold the number of voxels
+
+    // The squared distance (cm^2) from each voxel to the nearest voxel of
+    // mask, or to the nearest voxel not in mask if outside is true, very
+    // large if there is none, returns 0 if there is not enough memory
+    int squared(const Mask &mask, bool outside, Volume <float> *out);
+
+    // The distance (cm) from each voxel outside mask to it, and the negative
+    // distance from each voxel inside mask to the outside
+    int signedDistance(const Mask &mask, Volume <float> *out);
+
+    // Put mask grown by margin cm, or shrunk by -margin cm if it is negative,
+    // in out, returns 0 if there is not enough memory
+    int grow(const Mask &mask, double margin, Mask *out);
+
+    // Write a distance volume in the 3ddose format, with no errors
+    int save3ddose(QString path, const Volume <float> &values);
+
+    void transformLines(DistanceJob &job);
+
+private:
+    QVector <double> b[3]; // voxel boundaries
+    QVector <double> c[3]; // voxel centers
+    Volume <float> *vol;
+};
+
+#endif
@@ -0,0 +1,167 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "downsample.h"
+
+static void addDownsampleRow(DownsampleJob &job) {
+    job.ds->addRow(job);
+}
+
+Downsampler::Downsampler(const QVector <double> &sx, const QVector <double> &sy, const QVector <double> &sz,
+                         double size, int media, int structs, double fraction) {
+    x = coarseBounds(sx, size);
+    y = coarseBounds(sy, size);
+    z = coarseBounds(sz, size);
+    nx = x.size()-1;
+    ny = y.size()-1;
+    nz = z.size()-1;
+    snx = sx.size()-1;
+    sny = sy.size()-1;
+    numMedia = media;
+    numStructs = structs;
+    maskFraction = fraction;
+    sm = NULL;
+    sd = NULL;
+    ss = NULL;
+
+    // The overlap tables give the share of each output voxel each CT voxel
+    // makes up, the z one is also needed the other way around
+    ax = Resampler::buildAxis(sx, x, Resampler::Overlap);
+    ay = Resampler::buildAxis(sy, y, Resampler::Overlap);
+    az = Resampler::buildAxis(sz, z, Resampler::Overlap);
+    zTargets.resize(sz.size()-1);
+    zWeights.resize(sz.size()-1);
+    lastSource.fill(-1, nz);
+    for (int k = 0; k < nz; k++)
+        for (int t = az.start[k]; t < az.start[k+1]; t++) {
+            zTargets[az.index[t]] << k;
+            zWeights[az.index[t]] << az.weight[t];
+            lastSource[k] = az.index[t];
+        }
+
+    // Same media characters as DICOM_to_egsphant assigns
+    mediaIndex.fill(-1, 256);
+    for (int n = 0; n < numMedia; n++) {
+        char c = 49 + n + (n>8?7:0) + (n>34?6:0);
+        mediaIndex[(unsigned char)c] = n;
+        mediaCode << c;
+    }
+
+    m.resize(nx, ny, nz, '1');
+    d.resize(nx, ny, nz, 0);
+    for (int s = 0; s < numStructs; s++)
+        masks << new Mask(nx, ny, nz);
+}
+
+Downsampler::~Downsampler() {
+    qDeleteAll(active);
+    for (int s = 0; s < masks.size(); s++)
+        delete masks[s];
+}
+
+// Split the extent of b into voxels as close to size as fit a whole number
+QVector <double> Downsampler::coarseBounds(const QVector <double> &b, double size) {
+    double lo = b.first(), hi = b.last();
+    int n = int((hi-lo)/size+0.5);
+    n = n < 1 ? 1 : n;
+    QVector <double> out(n+1);
+    for (int i = 0; i < n; i++)
+        out[i] = lo+(hi-lo)*i/double(n);
+    out[n] = hi;
+    return out;
+}
+
+void Downsampler::addSlice(int k, const char *media, const double *densities, const int *structs) {
+    sm = media;
+    sd = densities;
+    ss = structs;
+
+    for (int t = 0; t < zTargets[k].size(); t++) {
+        int K = zTargets[k][t];
+        DownsampleSlice *slice = active.value(K, NULL);
+        if (slice == NULL) {
+            slice = new DownsampleSlice;
+            slice->den.fill(0, nx*ny);
+            slice->votes.fill(0, nx*ny*numMedia);
+            slice->occupancy.fill(0, ss == NULL ? 0 : nx*ny*numStructs);
+            active.insert(K, slice);
+        }
+
+        // Each output row only reads the CT slice, so they can all go at once
+        QVector <DownsampleJob> jobs(ny);
+        for (int j = 0; j < ny; j++) {
+            jobs[j].ds = this;
+            jobs[j].slice = slice;
+            jobs[j].wz = zWeights[k][t];
+            jobs[j].j = j;
+        }
+        QtConcurrent::blockingMap(jobs, addDownsampleRow);
+
+        if (lastSource[K] == k)
+            finishSlice(K);
+    }
+}
+
+void Downsampler::addRow(DownsampleJob &job) {
+    DownsampleSlice *slice = job.slice;
+    int J = job.j, n;
+    double wy, w;
+    for (int u = ay.start[J]; u < ay.start[J+1]; u++) {
+        int j = ay.index[u];
+        wy = job.wz*ay.weight[u];
+        for (int I = 0; I < nx; I++) {
+            n = J*nx+I;
+            for (int t = ax.start[I]; t < ax.start[I+1]; t++) {
+                unsigned long int i = (unsigned long int)j*snx+ax.index[t];
+                w = wy*ax.weight[t];
+                slice->den[n] += w*sd[i];
+                if (mediaIndex[(unsigned char)sm[i]] >= 0)
+                    slice->votes[n*numMedia+mediaIndex[(unsigned char)sm[i]]] += w;
+                if (ss != NULL && ss[i] > 0 && ss[i] <= numStructs)
+                    slice->occupancy[n*numStructs+ss[i]-1] += w;
+            }
+        }
+    }
+}
+
+void Downsampler::finishSlice(int K) {
+    DownsampleSlice *slice = active.take(K);
+    for (int J = 0; J < ny; J++)
+        for (int I = 0; I < nx; I++) {
+            int n = J*nx+I, best = 0;
+            for (int l = 1; l < numMedia; l++)
+                if (slice->votes[n*numMedia+l] > slice->votes[n*numMedia+best])
+                    best = l;
+            if (numMedia)
+                m(I,J,K) = mediaCode[best];
+            d(I,J,K) = slice->den[n];
+
+            if (slice->occupancy.size())
+                for (int s = 0; s < numStructs; s++)
+                    if (slice->occupancy[n*numStructs+s] >= maskFraction)
+                        masks[s]->set(I,J,K);
+        }
+
+    for (int s = 0; s < masks.size(); s++)
+        masks[s]->compress(K);
+    m.release(K, K+1);
+    d.release(K, K+1);
+    delete slice;
+}
+
+QVector <Mask*> Downsampler::takeMasks() {
+    QVector <Mask*> out = masks;
+    masks.clear();
+    return out;
+}
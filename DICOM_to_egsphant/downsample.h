@@ -0,0 +1,92 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef DOWNSAMPLE_H
+#define DOWNSAMPLE_H
+
+#include "mask.h"
+#include "resample.h"
+
+// The running sums of one output slice, for each voxel the mass weighted
+// density, the share of the voxel taken up by each medium and the share
+// taken up by each structure
+struct DownsampleSlice {
+    QVector <double> den;
+    QVector <float> votes;
+    QVector <float> occupancy;
+};
+
+class Downsampler;
+
+// One output row of a CT slice being added
+struct DownsampleJob {
+    Downsampler *ds;
+    DownsampleSlice *slice;
+    double wz; // the share of the output slice the CT slice makes up
+    int j;
+};
+
+// Aggregates the slices of a phantom on the CT grid onto a coarser grid as
+// they are converted, so that the full resolution phantom is never held
+//
+// Each output voxel takes the medium filling the largest share of it, the
+// mass conserving average density, and is part of a structure's mask when
+// the structure fills at least maskFraction of it
+class Downsampler {
+public:
+    // sx, sy and sz are the CT boundaries, and size the voxel size (cm) aimed
+    // for, which is adjusted on each axis to fit a whole number of voxels
+    Downsampler(const QVector <double> &sx, const QVector <double> &sy, const QVector <double> &sz,
+                double size, int numMedia, int numStructs, double maskFraction);
+    ~Downsampler();
+
+    int nx, ny, nz; // these hold the number of output voxels
+    QVector <double> x, y, z; // these hold their boundaries
+    Volume <char> m; // the output media
+    Volume <double> d; // the output densities
+
+    // Add CT slice k (slices must come in order) given its media, densities
+    // and structures, each x fastest, where structures are 0 outside of any
+    // or one more than the structure's index, and can be NULL for no masks
+    void addSlice(int k, const char *media, const double *densities, const int *structs);
+
+    // The masks of each structure over the output grid, which the caller
+    // then owns
+    QVector <Mask*> takeMasks();
+
+    // Add the current CT slice to row job.j of an output slice
+    void addRow(DownsampleJob &job);
+
+private:
+    int snx, sny; // CT voxels per row and column
+    int numMedia, numStructs;
+    double maskFraction;
+    ResampleAxis ax, ay, az;
+    QVector <QVector <int> > zTargets; // the output slices of each CT slice
+    QVector <QVector <double> > zWeights; // and the share it makes up of each
+    QVector <int> lastSource; // the last CT slice of each output slice
+    QVector <int> mediaIndex; // media character to 0 to numMedia-1
+    QVector <char> mediaCode; // and back
+    QHash <int, DownsampleSlice*> active; // output slices being added to
+    QVector <Mask*> masks;
+
+    const char *sm; // the CT slice being added
+    const double *sd;
+    const int *ss;
+
+    void finishSlice(int k);
+    static QVector <double> coarseBounds(const QVector <double> &b, double size);
+};
+
+#endif
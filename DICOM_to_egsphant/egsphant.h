@@ -18,6 +18,8 @@
 #include <QtWidgets>
 #include <iostream>
 #include <math.h>
+#include "volume.h"
+#include "grid.h"
 
 class EGSPhant : public QObject {
     Q_OBJECT
@@ -30,8 +32,9 @@ public:
 
     int nx, ny, nz; // these hold the number of voxels
     QVector <double> x, y, z; // these hold the boundaries of the above voxels
-    QVector <QVector <QVector <char> > > m; // this holds all the media
-    QVector <QVector <QVector <double> > > d; // this holds all the densities
+    GridAxis gx, gy, gz; // these find voxels along x, y and z, see updateGrid
+    Volume <char> m; // this holds all the media
+    Volume <double> d; // this holds all the densities
     QVector <QString> media; // this holds all the possible media
     double maxDensity;
 
@@ -46,6 +49,14 @@ public:
     char getMedia(double px, double py, double pz);
     double getDensity(double px, double py, double pz);
     int getIndex(QString axis, double p);
+    int getIndex(Axis axis, double p);
+
+    // Rebuild gx, gy and gz, needed whenever x, y or z are changed by hand
+    void updateGrid();
+
+    // Plane n along axis, laid out as described for extractPlane
+    void getPlane(Axis axis, int n, QVector <char> *out);
+    void getPlane(Axis axis, int n, QVector <double> *out);
     QImage getEGSPhantPicDen(QString axis, double ai, double af,
                              double bi, double bf, double d, double res);
     QImage getEGSPhantPicMed(QString axis, double ai, double af,
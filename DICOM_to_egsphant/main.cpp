@@ -1,4 +1,34 @@
 #include "DICOM.h"
+#include "mask.h"
+#include "blockphant.h"
+#include "merge.h"
+#include "downsample.h"
+#include "projection.h"
+#include "sliceimage.h"
+#include "voxelise.h"
+#include "distance.h"
+#include <QtConcurrent>
+
+// One contour (3006,0050) found by the structure query, its points are read in parallel
+struct ContourPoints {
+	ValueView view;
+	QPolygonF pos;
+	double z;
+	bool valid;
+};
+
+void readContourPoints(ContourPoints &contour) {
+	QStringList pointData = contour.view.toString().split('\\');
+	
+	// Skip anything too short to hold a single point
+	contour.valid = pointData.size() >= 3;
+	if (!contour.valid)
+		return;
+	
+	contour.z = pointData[2].toDouble()/10.0;
+	for (int m = 0; m+2 < pointData.size(); m+=3)
+		contour.pos << QPointF(pointData[m].toDouble()/10.0, pointData[m+1].toDouble()/10.0);
+}
 
 double interp(double x, double x1, double x2, double y1, double y2) {
 	return (y2*(x-x1)+y1*(x2-x))/(x2-x1);
@@ -64,6 +94,25 @@ void mergeSort(QVector <DICOM *> &data, int n) {
 	}
 }
 
+// The voxels of boundaries b that come within margin of lo to hi, as the
+// first one and their count, 0 if none do, voxels only touching the range
+// (to within rounding) are left out
+int cropRange(const QVector <double> &b, double lo, double hi, double margin, int *first) {
+	int n = b.size()-1, last = -1;
+	*first = -1;
+	for (int i = 0; i < n; i++)
+		if (b[i+1]-1e-6 > lo-margin && b[i]+1e-6 < hi+margin) {
+			if (*first < 0)
+				*first = i;
+			last = i;
+		}
+	if (*first < 0) {
+		*first = 0;
+		return 0;
+	}
+	return last-*first+1;
+}
+
 int main(int argc, char **argv) {
 	// Start clock for timing
     std::clock_t start;
@@ -77,8 +126,8 @@ int main(int argc, char **argv) {
 	In this section, all the inputs that the programmed is invoked
 	with are parsed.  This section reads in any file name given,
 	assuming its a DICOM file, unless the input has the format
-	"-makeMasks", "-outputImages", "-nominalDensity", or
-	"tag=string", then those appropriate options are enabled on
+	"-makeMasks", "-outputImages", "-outputDRR", "-nominalDensity",
+	"-compressed" or "tag=string", then those appropriate options are enabled on
 	instead.  If a file fails to be read in as DICOM, the code terminates.
 	
 	tag=string changes the lookup of the priority and TAS files 
@@ -91,19 +140,94 @@ int main(int argc, char **argv) {
 	used to identify structures later for post-processing apps
 	such as 3ddose_tools.
 	
+	outputDRR outputs DRRs (density times path length) and MIPs
+	(highest density) of the phantom as 16 bit PGMs, from the front
+	(along y) and the side (along x) with a source 100 cm from the
+	center of the phantom and the detector 150 cm from the source,
+	of drrSize=N (512 by default) pixels squared.
+	
 	outputImages outputs PNGs of each slice of the output phantoms
 	for both media and density, as well as outlines of structures
-	over the media images.  It is very time intensive, so best to
-	be used to check TAS and registration.
+	over the media images.  Slices are drawn and saved in parallel,
+	and it is best used to check TAS and registration.
 	
 	nominalDensity uses the file Default_mediaDensity.txt (where
 	the file lookup would change for the appropriate tag) to
 	assign densities to all media.
+	
+	compressed also outputs the phantom as 8x8x8 blocks, where
+	uniform blocks (air, or tissue at nominal density) are stored
+	as one medium and density, to PrimaryOutput.cegsphant, and
+	reports how much smaller that is than the full grid.
+	
+	merge=T merges neighbouring planes of voxels (along x, then y,
+	then z) wherever each voxel keeps its medium and its density
+	within a fraction T of the first plane merged, giving a non-
+	uniform grid with far fewer voxels away from the target.
+	Merged densities are mass weighted.  mergeKeep=name (which can
+	be given more than once) keeps all planes through structure
+	name, plus mergeMargin=X cm on either side, at the CT
+	resolution.  Masks are still output on the CT grid.
+	
+	cropROI=name crops the phantom to the bounding box of structure
+	name (typically External or Body), cropHU=T to the box around
+	all voxels above T HU, and crop=x0,x1,y0,y1,z0,z1 to the given
+	box in egsphant coordinates (cm), each grown by cropMargin=X
+	cm.  If more than one is given the phantom is cropped to where
+	they overlap.  Only the cropped voxels are ever converted.
+	
+	voxelSize=X builds the egsphant on a grid of X cm voxels (as
+	close to X as fits the CT extent) rather than the CT grid, as
+	each CT slice is converted.  Each voxel takes the medium that
+	fills most of it and the mass conserving average density, and
+	is part of a mask when the structure fills at least
+	maskFraction=F (0.5 by default) of it.
+	
+	voxelise=file writes the spheres, cylinders, capsules and STL
+	meshes listed in file (seeds, applicators, catheters) into the
+	phantom, in egsphant coordinates (cm), one per line as
+		sphere MEDIUM DENSITY x y z r
+		cylinder MEDIUM DENSITY x0 y0 z0 x1 y1 z1 r
+		capsule MEDIUM DENSITY x0 y0 z0 x1 y1 z1 r
+		mesh MEDIUM DENSITY file.stl [scale]
+	Each voxel takes the medium of a primitive covering at least
+	half of it and the covered fraction of its density, coverage
+	being found along voxelSamples=N (4 by default) lines squared
+	through each voxel.  Later primitives go over earlier ones.
+	
+	margin=name,X outputs structure name grown by X cm (or shrunk
+	if X is negative) as a mask, ring=name,X0,X1 the shell from X0
+	to X1 cm outside it (X0 < X1, negative X0 reaching inside it),
+	and distanceMap=name its signed distance
+	(cm, negative inside) as name_distance.3ddose.
+	shell=name,X0,X1,MEDIUM,DENSITY writes MEDIUM at DENSITY into
+	the phantom over that same shell (before voxelise).  Distances
+	are exact, between voxel centers, and these all turn on
+	makeMasks.
+	
+	scratch=path keeps very large volumes in memory mapped files
+	in the directory path rather than in memory, so that phantoms
+	bigger than the available memory can still be built, one slice
+	at a time.
 	*/
 	
 	bool makeMasks = false;
 	bool outputImages = false;
+	bool outputDRR = false;
+	int drrSize = 512;
 	bool nominalDensity = false;
+	bool compressed = false;
+	bool merge = false;
+	double mergeTolerance = 0, mergeMargin = 0;
+	QStringList mergeKeep;
+	double voxelSize = 0, maskFraction = 0.5;
+	QString cropROI;
+	double cropHU = 0, cropMargin = 0;
+	bool cropByHU = false;
+	QVector <double> cropBox;
+	QStringList voxelise;
+	QStringList margins, rings, distanceMaps, shells;
+	int voxelSamples = 4;
 	QString TAS_tag("Default");
 	
 	if (argc == 1) {
@@ -118,14 +242,64 @@ int main(int argc, char **argv) {
     for (int i = 0; i < argc-1; i++) {
         QString path(argv[i+1]);
         DICOM *d = new DICOM(&dat);
+        d->skipPrivate = d->skipOverlays = true; // Vendor data and overlays are never used
         if (!path.compare("-outputImages"))
 			outputImages = true;
+		else if (!path.compare("-outputDRR"))
+			outputDRR = true;
+		else if (!path.left(8).compare("drrSize="))
+			drrSize = path.right(path.size()-8).toInt();
 		else if (!path.compare("-makeMasks"))
 			makeMasks = true;
 		else if (!path.compare("-nominalDensity"))
 			nominalDensity = true;
+		else if (!path.compare("-compressed"))
+			compressed = true;
+		else if (!path.left(6).compare("merge=")) {
+			merge = true;
+			mergeTolerance = path.right(path.size()-6).toDouble();
+		}
+		else if (!path.left(10).compare("mergeKeep="))
+			mergeKeep << path.right(path.size()-10);
+		else if (!path.left(12).compare("mergeMargin="))
+			mergeMargin = path.right(path.size()-12).toDouble();
+		else if (!path.left(8).compare("cropROI="))
+			cropROI = path.right(path.size()-8);
+		else if (!path.left(7).compare("cropHU=")) {
+			cropByHU = true;
+			cropHU = path.right(path.size()-7).toDouble();
+		}
+		else if (!path.left(11).compare("cropMargin="))
+			cropMargin = path.right(path.size()-11).toDouble();
+		else if (!path.left(5).compare("crop=")) {
+			QStringList bounds = path.right(path.size()-5).split(',');
+			if (bounds.size() != 6) {
+				std::cout << "crop needs six comma separated bounds, quitting...\n";
+				return -1;
+			}
+			for (int j = 0; j < 6; j++)
+				cropBox << bounds[j].toDouble();
+		}
+		else if (!path.left(10).compare("voxelSize="))
+			voxelSize = path.right(path.size()-10).toDouble();
+		else if (!path.left(13).compare("maskFraction="))
+			maskFraction = path.right(path.size()-13).toDouble();
+		else if (!path.left(7).compare("margin="))
+			margins << path.right(path.size()-7);
+		else if (!path.left(5).compare("ring="))
+			rings << path.right(path.size()-5);
+		else if (!path.left(12).compare("distanceMap="))
+			distanceMaps << path.right(path.size()-12);
+		else if (!path.left(6).compare("shell="))
+			shells << path.right(path.size()-6);
+		else if (!path.left(9).compare("voxelise="))
+			voxelise << path.right(path.size()-9);
+		else if (!path.left(13).compare("voxelSamples="))
+			voxelSamples = path.right(path.size()-13).toInt();
 		else if (!path.left(4).compare("tag="))
 			TAS_tag = path.right(path.size()-4);
+		else if (!path.left(8).compare("scratch="))
+			volumeScratchDir() = path.right(path.size()-8);
 		else if (d->parse(path)) {
             //debug//std::cout << std::dec << "Successfully parsed " << path.toStdString() << ".\n";
             dicom.append(d);
@@ -142,6 +316,8 @@ int main(int argc, char **argv) {
     }
 	
 	// Options
+	if (!margins.isEmpty() || !rings.isEmpty() || !distanceMaps.isEmpty() || !shells.isEmpty())
+		makeMasks = true; // Margins are all worked out from the structure masks
 	
 	duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
 	std::cout << "Parsed the " << dicom.size() << " DICOM files.  Time elapsed is " << duration << " s.\n";
@@ -364,8 +540,9 @@ int main(int argc, char **argv) {
 	contour data.
 	
 	This section involves reading SQ at one and two layers deep,
-	so the parseSequence function is invoked several times to
-	parse the appropriate data.
+	so all the paths are compiled into one TagQuery which picks
+	them out of every RS file in a single pass, and the contour
+	points are then read in parallel.
 	
 	The structures (which are many sets of [x,y,z] positions)
 	into an array of polygons and an array of z positions, for
@@ -380,105 +557,72 @@ int main(int argc, char **argv) {
 	QMap <int, int> structLookup;
 	QVector <int> structReference;
 	
-	// Data for parsing singly and doubly nested SQ sets and point data strings
-	QVector <Attribute*> *att, *att2;
-	QByteArray tempData, tempData2;
-	QStringList pointData;
-	
-    for (int i = 0; i < dicomExtra.size(); i++) {
-        for (int j = 0; j < dicomExtra[i]->data.size(); j++) {
-            // Structure info (looking for structure names and nums)
-            if (dicomExtra[i]->data[j]->tag[0] == 0x3006 && dicomExtra[i]->data[j]->tag[1] == 0x0020) {
-				for (int k = 0; k < dicomExtra[i]->data[j]->seq.items.size(); k++) {
-					tempData = QByteArray((char*)dicomExtra[i]->data[j]->seq.items[k]->vf,dicomExtra[i]->data[j]->seq.items[k]->vl);
-					QDataStream dataStream(tempData);
-					
-					att = new QVector <Attribute*>;
-					if (!dicomExtra[i]->parseSequence(&dataStream, att)) {
-						std::cout << "Failed to parse sequence data for tag (3006,0020), quitting...\n";
-						return 0;
-					}
-					
-					QString tempS = ""; // Get the name
-					QString tempI = ""; // Get the number
-					for (int l = 0; l < att->size(); l++) {
-						if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0026)
-							for (unsigned int s = 0; s < att->at(l)->vl; s++)
-								tempS.append(att->at(l)->vf[s]);
-						else if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0022)
-							for (unsigned int s = 0; s < att->at(l)->vl; s++)
-								tempI.append(att->at(l)->vf[s]);
-					}
-					tempS = tempS.trimmed().replace(' ','_');
-					
-					structName.append(tempS.trimmed());
-					structNum.append(tempI.toInt());
-					structLookup[tempI.toInt()] = structName.size()-1;
-					
-					for (int l = 0; l < att->size(); l++)
-						delete att->at(l);
-					delete att;
+	// Compile the paths to all the data we want
+	TagQuery query;
+	int nameQuery = query.add("(3006,0020)[*]/(3006,0026)");
+	int numQuery = query.add("(3006,0020)[*]/(3006,0022)");
+	int contourQuery = query.add("(3006,0039)[*]/(3006,0040)");
+	int pointQuery = query.add("(3006,0039)[*]/(3006,0040)[*]/(3006,0050)");
+	int referenceQuery = query.add("(3006,0039)[*]/(3006,0084)");
+	
+	QVector <QVector <ValueView> > found;
+	if (!query.run(dicomExtra, &found)) {
+		std::cout << "Failed to parse the structure sequences, quitting...\n";
+		return 0;
+	}
+	
+	// Read all the contour points at once
+	QVector <ContourPoints> contours;
+	for (int i = 0; i < found.size(); i++)
+		for (int j = 0; j < found[i].size(); j++)
+			if (found[i][j].path == pointQuery) {
+				contours.resize(contours.size()+1);
+				contours.last().view = found[i][j];
+			}
+	QtConcurrent::blockingMap(contours, readContourPoints);
+	
+	// Then collect everything in file order, matches from the same item are together
+	int contour = 0;
+    for (int i = 0; i < found.size(); i++) {
+		int nameItem = -1, contourItem = -1;
+		for (int j = 0; j < found[i].size(); j++) {
+			ValueView &view = found[i][j];
+			
+			// Structure info (looking for structure names and nums)
+			if (view.path == nameQuery || view.path == numQuery) {
+				if (view.items[0] != nameItem) {
+					nameItem = view.items[0];
+					structName.append("");
+					structNum.append(0);
+				}
+				
+				if (view.path == nameQuery) {
+					structName.last() = view.toString().trimmed().replace(' ','_');
+				}
+				else {
+					structNum.last() = view.toString().toInt();
+					structLookup[structNum.last()] = structName.size()-1;
 				}
 			} // Structure data (looking for contour definitions)
-			else if (dicomExtra[i]->data[j]->tag[0] == 0x3006 && dicomExtra[i]->data[j]->tag[1] == 0x0039) {
-				for (int k = 0; k < dicomExtra[i]->data[j]->seq.items.size(); k++) {
-					tempData = QByteArray((char*)dicomExtra[i]->data[j]->seq.items[k]->vf,dicomExtra[i]->data[j]->seq.items[k]->vl);
-					QDataStream dataStream(tempData);
-					
-					att = new QVector <Attribute*>;
-					if (!dicomExtra[i]->parseSequence(&dataStream, att)) {
-						std::cout << "Failed to parse sequence data for tag (3006,0039), quitting...\n";
-						return 0;
-					}
-					
-					QString tempS = ""; // Get the contour, it's another nested sequence, so we must go deeper with parseSequence
-					for (int l = 0; l < att->size(); l++) {
-						if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0040)
-						{
-							structZ.resize(structZ.size()+1);
-							structPos.resize(structPos.size()+1);
-							for (int k = 0; k < att->at(l)->seq.items.size(); k++) {
-								structPos.last().resize(structPos.last().size()+1);
-								tempData2 = QByteArray((char*)att->at(l)->seq.items[k]->vf,att->at(l)->seq.items[k]->vl);
-								QDataStream dataStream2(tempData2);
-								
-								att2 = new QVector <Attribute*>;
-								if (!dicomExtra[i]->parseSequence(&dataStream2, att2)) {
-									std::cout << "Failed to parse sequence data for tag (3006,0040), quitting...\n";
-									return 0;
-								}
-								
-								QString tempS = ""; // Get the points
-								for (int m = 0; m < att2->size(); m++)
-									if (att2->at(m)->tag[0] == 0x3006 && att2->at(m)->tag[1] == 0x0050)
-										for (unsigned int s = 0; s < att2->at(m)->vl; s++)
-											tempS.append(att2->at(m)->vf[s]);
-								
-								pointData = tempS.split('\\');
-								structZ.last().append(pointData[2].toDouble()/10.0);
-								for (int m = 0; m < pointData.size(); m+=3)
-									structPos.last().last() << QPointF(pointData[m].toDouble()/10.0, pointData[m+1].toDouble()/10.0);
-								
-								for (int m = 0; m < att2->size(); m++)
-									delete att2->at(m);
-								delete att2;
-							}
-						}
-						else if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0084) {
-							QString tempI = ""; // Get the number
-							for (unsigned int s = 0; s < att->at(l)->vl; s++)
-								tempI.append(att->at(l)->vf[s]);
-							structReference.append(tempI.toInt());
-						}
-					}
-										
-					for (int l = 0; l < att->size(); l++)
-						delete att->at(l);
-					delete att;
+			else if (view.path == contourQuery) {
+				structZ.resize(structZ.size()+1);
+				structPos.resize(structPos.size()+1);
+				contourItem = view.items[0];
+			}
+			else if (view.path == pointQuery) {
+				if (view.items[0] == contourItem && contours[contour].valid) {
+					structZ.last().append(contours[contour].z);
+					structPos.last().append(contours[contour].pos);
 				}
+				contour++;
+			}
+			else if (view.path == referenceQuery) {
+				structReference.append(view.toString().toInt());
 			}
 		}
 	}
+	contours.clear();
+	
 	duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
 	std::cout << "Extracted data for all " << structName.size() << " structures.  Time elapsed is " << duration << " s.\n";
 
@@ -716,17 +860,6 @@ int main(int argc, char **argv) {
 			}
 	}
 	
-	{
-		QVector <char> mz(phant.nz, 0);
-		QVector <QVector <char> > my(phant.ny, mz);
-		QVector <QVector <QVector <char> > > mx(phant.nx, my);
-		phant.m = mx;
-		QVector <double> dz(phant.nz, 0);
-		QVector <QVector <double> > dy(phant.ny, dz);
-		QVector <QVector <QVector <double> > > dx(phant.nx, dy);
-		phant.d = dx;
-	}
-	
 	// Define xy bound values, still assuming first slice matches the rest
     for (int i = 0; i <= phant.nx; i++)
 		phant.x[i] = (imagePos[0][0]+(i-0.5)*xySpacing[0][0])/10.0;
@@ -742,6 +875,80 @@ int main(int argc, char **argv) {
 		phant.z[i] = prevZ/10.0;
 	}
 	phant.z.last() = nextZ/10.0;
+	
+	// Crop to the box(es) asked for, all in egsphant coordinates, where y is
+	// mirrored from the CT y as rows are stored from the bottom up
+	QVector <double> ctY = phant.y;
+	int i0 = 0, k0 = 0, cj0 = 0; // First CT column, slice and row converted
+	QVector <double> box;
+	box << phant.x.first() << phant.x.last() << phant.y.first() << phant.y.last() << phant.z.first() << phant.z.last();
+	double yMirror = phant.y.first()+phant.y.last();
+	if (cropBox.size() == 6) {
+		box[0] = qMax(box[0], cropBox[0]); box[1] = qMin(box[1], cropBox[1]);
+		box[2] = qMax(box[2], cropBox[2]); box[3] = qMin(box[3], cropBox[3]);
+		box[4] = qMax(box[4], cropBox[4]); box[5] = qMin(box[5], cropBox[5]);
+	}
+	if (!cropROI.isEmpty()) {
+		QRectF rect;
+		double zLo = phant.z.last(), zHi = phant.z.first();
+		for (int l = 0; l < structPos.size(); l++)
+			if (!structName[structLookup[structReference[l]]].compare(cropROI, Qt::CaseInsensitive))
+				for (int m = 0; m < structPos[l].size(); m++) {
+					rect = rect.united(structPos[l][m].boundingRect());
+					zLo = qMin(zLo, structZ[l][m]);
+					zHi = qMax(zHi, structZ[l][m]);
+				}
+		if (rect.isNull()) {
+			std::cout << "Did not find structure " << cropROI.toStdString() << " to crop to, quitting...\n";
+			return -1;
+		}
+		box[0] = qMax(box[0], rect.left()); box[1] = qMin(box[1], rect.right());
+		box[2] = qMax(box[2], yMirror-rect.bottom()); box[3] = qMin(box[3], yMirror-rect.top());
+		box[4] = qMax(box[4], zLo); box[5] = qMin(box[5], zHi);
+	}
+	if (cropByHU) {
+		int lo[3] = {phant.nx, phant.ny, phant.nz}, hi[3] = {-1, -1, -1};
+		for (int k = 0; k < phant.nz; k++)
+			for (int j = 0; j < phant.ny; j++)
+				for (int i = 0; i < phant.nx; i++)
+					if (HU[k][j][i] > cropHU) {
+						lo[0] = qMin(lo[0], i); hi[0] = qMax(hi[0], i);
+						lo[1] = qMin(lo[1], j); hi[1] = qMax(hi[1], j);
+						lo[2] = qMin(lo[2], k); hi[2] = qMax(hi[2], k);
+					}
+		if (hi[0] < 0) {
+			std::cout << "No voxels are above " << cropHU << " HU to crop to, quitting...\n";
+			return -1;
+		}
+		box[0] = qMax(box[0], phant.x[lo[0]]); box[1] = qMin(box[1], phant.x[hi[0]+1]);
+		box[2] = qMax(box[2], yMirror-phant.y[hi[1]+1]); box[3] = qMin(box[3], yMirror-phant.y[lo[1]]);
+		box[4] = qMax(box[4], phant.z[lo[2]]); box[5] = qMin(box[5], phant.z[hi[2]+1]);
+	}
+	if (cropBox.size() == 6 || !cropROI.isEmpty() || cropByHU) {
+		int pj0, nx = phant.nx, ny = phant.ny, nz = phant.nz;
+		phant.nx = cropRange(phant.x, box[0], box[1], cropMargin, &i0);
+		phant.ny = cropRange(phant.y, box[2], box[3], cropMargin, &pj0);
+		phant.nz = cropRange(phant.z, box[4], box[5], cropMargin, &k0);
+		if (!phant.nx || !phant.ny || !phant.nz) {
+			std::cout << "Nothing is left of the phantom after cropping, quitting...\n";
+			return -1;
+		}
+		cj0 = ny-pj0-phant.ny; // Rows are stored bottom up
+		phant.x = phant.x.mid(i0, phant.nx+1);
+		phant.y = phant.y.mid(pj0, phant.ny+1);
+		phant.z = phant.z.mid(k0, phant.nz+1);
+		std::cout << "Cropped the phantom from " << nx << "x" << ny << "x" << nz << " to "
+				  << phant.nx << "x" << phant.ny << "x" << phant.nz << " voxels.\n";
+	}
+	phant.updateGrid(); // Done with the boundaries
+	
+	// The full CT grid is only held if it is not downsampled
+	if (voxelSize <= 0) {
+		if (!phant.m.resize(phant.nx, phant.ny, phant.nz, 0) || !phant.d.resize(phant.nx, phant.ny, phant.nz, 0)) {
+			std::cout << "Not enough memory for the phantom, try voxelSize=X or scratch=path, quitting...\n";
+			return -1;
+		}
+	}
 		
 	// ---------------------------------------------------------- //
 	// CONVERTING HU TO APPROPRIATE DENSITY AND MEDIUM            //
@@ -779,14 +986,39 @@ int main(int argc, char **argv) {
 		}
 	}
 	
-	// Setup masks if makeMasks is set
-	QVector <EGSPhant*> masks;
-	if (makeMasks && !structName.isEmpty()) {
-		for (int i = 0; i < structName.size(); i++) {
-			EGSPhant* temp = new EGSPhant;
-			temp->makeMask(&phant);
-			masks << temp;
+	// Setup masks if makeMasks is set, the downsampler makes its own
+	QVector <Mask*> masks;
+	if (makeMasks && !structName.isEmpty() && voxelSize <= 0) {
+		for (int i = 0; i < structName.size(); i++)
+			masks << new Mask(phant.nx, phant.ny, phant.nz);
+	}
+	
+	// When downsampling, each CT slice is converted into these and then added
+	// to the coarse grid, otherwise straight into phant
+	Downsampler *downsampler = NULL;
+	Volume <char> sliceM;
+	Volume <double> sliceD;
+	QVector <int> sliceS;
+	char *medSlice;
+	double *denSlice;
+	if (voxelSize > 0) {
+		downsampler = new Downsampler(phant.x, phant.y, phant.z, voxelSize, phant.media.size(),
+									  makeMasks ? structName.size() : 0, maskFraction);
+		if (downsampler->m.isEmpty() || downsampler->d.isEmpty() ||
+			!sliceM.resize(phant.nx, phant.ny, 1, 0) || !sliceD.resize(phant.nx, phant.ny, 1, 0)) {
+			std::cout << "Not enough memory for the downsampled phantom, quitting...\n";
+			delete downsampler;
+			return -1;
 		}
+		sliceS.fill(0, phant.nx*phant.ny);
+	}
+	
+	// Bounds (xyz low then high, in cm) of the structures kept by merging
+	QVector <bool> mergeStruct(structName.size(), false);
+	QVector <QVector <double> > keepBox(structName.size());
+	for (int i = 0; i < structName.size(); i++) {
+		mergeStruct[i] = mergeKeep.contains(structName[i]);
+		keepBox[i] << phant.x.last() << phant.y.last() << phant.z.last() << phant.x[0] << phant.y[0] << phant.z[0];
 	}
 	
 	// Arrays that hold the struct numbers and center voxel values to be used
@@ -797,6 +1029,11 @@ int main(int argc, char **argv) {
 	
 	// Convert HU to density and media without masks
 	for (int k = 0; k < phant.nz; k++) { // Z //
+		medSlice = downsampler ? sliceM.data() : phant.m.slice(k);
+		denSlice = downsampler ? sliceD.data() : phant.d.slice(k);
+		if (downsampler)
+			sliceS.fill(0);
+		
 		if (structZ.size() > 0) {
 			zIndex.clear(); // Reset lookup
 			zMid = (phant.z[k]+phant.z[k+1])/2.0;
@@ -813,7 +1050,7 @@ int main(int argc, char **argv) {
 		for (int j = 0; j < phant.ny; j++) { // Y //
 			if (zIndex.size() > 0) {
 				yIndex.clear(); // Reset lookup
-				yMid = (phant.y[j]+phant.y[j+1])/2.0;
+				yMid = (ctY[cj0+j]+ctY[cj0+j+1])/2.0;
 				for (p = zIndex.begin(); p != zIndex.end(); p++) {
 					// If column p->y() of struct p->x() on the same column as slice k,j of the phantom
 					if (structRect[p->x()][p->y()].top() <= yMid && yMid <= structRect[p->x()][p->y()].bottom()) {
@@ -823,7 +1060,7 @@ int main(int argc, char **argv) {
 			}
 			
 			for (int i = 0; i < phant.nx; i++) { // X //
-				tempHU = HU[k][j][i];
+				tempHU = HU[k0+k][cj0+j][i0+i];
 				nj = phant.ny-1-j; // Reversed j index for density and media assignment
 				xMid = (phant.x[i]+phant.x[i+1])/2.0;
 				
@@ -841,7 +1078,7 @@ int main(int argc, char **argv) {
 				if (temp > phant.maxDensity) // Track max density for images
 					phant.maxDensity = temp;
 				
-				phant.d[i][nj][k] = temp;
+				denSlice[nj*phant.nx+i] = temp;
 				
 				// get the right media
 				if (yIndex.size() > 0) {
@@ -865,29 +1102,172 @@ int main(int argc, char **argv) {
 						if (temp < denThresholds[q][n])
 							break;
 					
-					phant.m[i][phant.ny-1-j][k] = mediaMap[medThresholds[q][n]];
-					if (makeMasks)
-						masks[inStruct]->m[i][nj][k] = 1;
+					medSlice[nj*phant.nx+i] = mediaMap[medThresholds[q][n]];
+					if (makeMasks && downsampler)
+						sliceS[nj*phant.nx+i] = q+1;
+					else if (makeMasks)
+						masks[q]->set(i,nj,k); // Masks follow structName, not the contour order
+					if (merge && mergeStruct[q]) {
+						keepBox[q][0] = qMin(keepBox[q][0], phant.x[i]); keepBox[q][3] = qMax(keepBox[q][3], phant.x[i+1]);
+						keepBox[q][1] = qMin(keepBox[q][1], phant.y[nj]); keepBox[q][4] = qMax(keepBox[q][4], phant.y[nj+1]);
+						keepBox[q][2] = qMin(keepBox[q][2], phant.z[k]); keepBox[q][5] = qMax(keepBox[q][5], phant.z[k+1]);
+					}
 				}
 				else {
 					for (n = 0; n < denThreshold.size()-1; n++)
 						if (temp < denThreshold[n])
 							break;
 						
-					phant.m[i][nj][k] = 49 + n + (n>8?7:0) + (n>34?6:0);
+					medSlice[nj*phant.nx+i] = 49 + n + (n>8?7:0) + (n>34?6:0);
 				}
 				
 				
 				if (nominalDensity) {
-					n = phant.m[i][nj][k] - 49;
+					n = medSlice[nj*phant.nx+i] - 49;
 					n = n>8?n-7:n;
 					n = n>26?n-6:n;
 					for (int l = 0; l < medNom.size(); l++)
 						if (!medNom[l].compare(phant.media[n]))
-							phant.d[i][nj][k] = denNom[l];
+							denSlice[nj*phant.nx+i] = denNom[l];
+				}
+			}
+		}
+		
+		// Only the runs of finished mask slices are kept
+		for (int l = 0; l < masks.size(); l++)
+			masks[l]->compress(k);
+		
+		// and finished phantom slices can leave memory if they are mapped
+		if (downsampler)
+			downsampler->addSlice(k, medSlice, denSlice, makeMasks ? sliceS.constData() : NULL);
+		phant.m.release(k, k+1);
+		phant.d.release(k, k+1);
+	}
+	
+	// Switch phant over to the coarse grid
+	if (downsampler) {
+		unsigned long int before = (unsigned long int)phant.nx*phant.ny*phant.nz;
+		phant.nx = downsampler->nx;
+		phant.ny = downsampler->ny;
+		phant.nz = downsampler->nz;
+		phant.x = downsampler->x;
+		phant.y = downsampler->y;
+		phant.z = downsampler->z;
+		phant.m.swap(downsampler->m); // Handed over, not copied
+		phant.d.swap(downsampler->d);
+		phant.updateGrid();
+		masks = downsampler->takeMasks();
+		delete downsampler;
+		std::cout << "Downsampled from " << before << " CT voxels to " << (unsigned long int)phant.nx*phant.ny*phant.nz
+				  << " voxels (" << phant.nx << "x" << phant.ny << "x" << phant.nz << ").\n";
+	}
+	
+	// Grow, shrink and ring structures, output distance maps and write media
+	// shells, all while the masks are still on the phantom grid
+	QVector <Mask*> extraMasks;
+	QStringList extraNames;
+	if (!masks.isEmpty() && (margins.size() || rings.size() || distanceMaps.size() || shells.size())) {
+		DistanceTransform distance(phant.x, phant.y, phant.z);
+		QStringList parts;
+		int s;
+		
+		for (int i = 0; i < margins.size(); i++) {
+			parts = margins[i].split(',');
+			s = structName.indexOf(parts[0]);
+			if (parts.size() != 2 || s < 0) {
+				std::cout << "margin=" << margins[i].toStdString() << " is not an existing structure and a margin, skipping it.\n";
+				continue;
+			}
+			Mask *grown = new Mask;
+			if (!distance.grow(*masks[s], parts[1].toDouble(), grown)) {
+				std::cout << "Not enough memory for margin=" << margins[i].toStdString() << ", quitting...\n";
+				delete grown;
+				return -1;
+			}
+			extraMasks << grown;
+			extraNames << parts[0]+"_margin"+parts[1];
+		}
+		
+		for (int i = 0; i < rings.size() + shells.size(); i++) {
+			QString ring = i < rings.size() ? rings[i] : shells[i-rings.size()];
+			parts = ring.split(',');
+			s = structName.indexOf(parts[0]);
+			if (parts.size() != (i < rings.size() ? 3 : 5) || s < 0 || parts[1].toDouble() >= parts[2].toDouble()) {
+				std::cout << (i < rings.size() ? "ring=" : "shell=") << ring.toStdString()
+						  << " is not an existing structure and a shell (X0 < X1), skipping it.\n";
+				continue;
+			}
+			
+			// The voxels within the outer margin, less those within the inner
+			// (which shrinks the structure when it is negative)
+			Mask *shell = new Mask;
+			Mask inner;
+			if (!distance.grow(*masks[s], parts[2].toDouble(), shell) ||
+				(parts[1].toDouble() != 0 && !distance.grow(*masks[s], parts[1].toDouble(), &inner))) {
+				std::cout << "Not enough memory for " << (i < rings.size() ? "ring=" : "shell=") << ring.toStdString() << ", quitting...\n";
+				delete shell;
+				return -1;
+			}
+			shell->subtract(parts[1].toDouble() != 0 ? inner : *masks[s]);
+			
+			if (i < rings.size()) {
+				extraMasks << shell;
+				extraNames << parts[0]+"_ring"+parts[1]+"-"+parts[2];
+				continue;
+			}
+			
+			// Shells are written into the phantom, adding their medium if new
+			int medium = phant.media.indexOf(parts[3]);
+			if (medium < 0) {
+				medium = phant.media.size();
+				phant.media << parts[3];
+			}
+			char c = 49 + medium + (medium>8?7:0) + (medium>34?6:0);
+			double density = parts[4].toDouble();
+			phant.maxDensity = qMax(phant.maxDensity, density);
+			QVector <int> runs;
+			for (int k = 0; k < phant.nz; k++)
+				for (int j = 0; j < phant.ny; j++) {
+					runs = shell->rowRuns(j, k);
+					for (int r = 0; r < runs.size(); r += 2)
+						for (int l = runs[r]; l < runs[r+1]; l++) {
+							phant.m(l,j,k) = c;
+							phant.d(l,j,k) = density;
+						}
 				}
+			std::cout << "Wrote a " << parts[3].toStdString() << " shell of " << shell->count() << " voxels around "
+					  << parts[0].toStdString() << ".\n";
+			delete shell;
+		}
+		
+		for (int i = 0; i < distanceMaps.size(); i++) {
+			s = structName.indexOf(distanceMaps[i]);
+			if (s < 0) {
+				std::cout << "distanceMap=" << distanceMaps[i].toStdString() << " is not an existing structure, skipping it.\n";
+				continue;
+			}
+			Volume <float> dist;
+			if (!distance.signedDistance(*masks[s], &dist)) {
+				std::cout << "Not enough memory for distanceMap=" << distanceMaps[i].toStdString() << ", quitting...\n";
+				return -1;
 			}
+			if (!distance.save3ddose(distanceMaps[i]+"_distance.3ddose", dist))
+				return -1;
 		}
+		
+		duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+		std::cout << "Made " << extraMasks.size() << " margin masks, " << shells.size() << " shells and "
+				  << distanceMaps.size() << " distance maps.  Time elapsed is " << duration << " s.\n";
+	}
+	
+	// Write any seeds, applicators and catheters over the phantom
+	if (!voxelise.isEmpty()) {
+		Voxeliser voxeliser(&phant, voxelSamples);
+		for (int i = 0; i < voxelise.size(); i++)
+			if (!voxeliser.loadFile(voxelise[i]))
+				return -1;
+		unsigned long int changed = voxeliser.apply();
+		std::cout << "Voxelised " << voxeliser.size() << " primitives into " << changed << " voxels.\n";
 	}
 	
 	duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
@@ -895,19 +1275,61 @@ int main(int argc, char **argv) {
 			  << phant.y[0] << "," << phant.y[phant.ny] << "], z:["
 			  << phant.z[0] << "," << phant.z[phant.nz] << "]).  Time elapsed is " << duration << " s.\n";
 	
+	// Merge homogeneous planes outside the kept structures, keeping the CT
+	// grid for the masks
+	EGSPhant nativeGrid;
+	nativeGrid.x = phant.x;
+	nativeGrid.y = phant.y;
+	nativeGrid.z = phant.z;
+	if (merge) {
+		QVector <bool> keepX, keepY, keepZ;
+		for (int i = 0; i < structName.size(); i++)
+			if (mergeStruct[i]) {
+				keepPlanes(phant.x, keepBox[i][0], keepBox[i][3], mergeMargin, &keepX);
+				keepPlanes(phant.y, keepBox[i][1], keepBox[i][4], mergeMargin, &keepY);
+				keepPlanes(phant.z, keepBox[i][2], keepBox[i][5], mergeMargin, &keepZ);
+			}
+		
+		unsigned long int before = (unsigned long int)phant.nx*phant.ny*phant.nz;
+		if (mergePlanes(&phant, XAxis, keepX, mergeTolerance) < 0 || mergePlanes(&phant, YAxis, keepY, mergeTolerance) < 0 ||
+			mergePlanes(&phant, ZAxis, keepZ, mergeTolerance) < 0) {
+			std::cout << "Not enough memory to merge the egsphant, quitting...\n";
+			return -1;
+		}
+		duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+		std::cout << "Merged the egsphant from " << before << " down to " << (unsigned long int)phant.nx*phant.ny*phant.nz
+				  << " voxels (" << phant.nx << "x" << phant.ny << "x" << phant.nz << ").  Time elapsed is " << duration << " s.\n";
+	}
+	
 	// Save file
 	phant.saveEGSPhantFile("PrimaryOutput.egsphant");
 	//phant.savebEGSPhantFile("PrimaryOutput.begsphant");
 	duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
     std::cout << "File successfully output.  Time elapsed is " << duration << " s.\n";
 	
+	if (compressed) {
+		BlockPhant blockPhant;
+		blockPhant.compress(&phant);
+		if (!blockPhant.saveFile("PrimaryOutput.cegsphant"))
+			return -1;
+		duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+		std::cout << "Compressed file output, " << blockPhant.uniformBlocks() << " of the "
+				  << ((phant.nx+7)/8)*((phant.ny+7)/8)*((phant.nz+7)/8) << " blocks are uniform for a compression ratio of "
+				  << blockPhant.compressionRatio() << ".  Time elapsed is " << duration << " s.\n";
+	}
+	
 	// Output and delete masks
 	if (makeMasks && !structName.isEmpty()) {
 		for (int i = masks.size()-1; i >= 0; i--) {
-			masks[i]->saveEGSPhantFile(structName[i]+"_mask.egsphant");
+			masks[i]->saveEGSPhantFile(structName[i]+"_mask.egsphant", &nativeGrid);
 			delete masks[i];
 		}
 		masks.clear();
+		for (int i = 0; i < extraMasks.size(); i++) {
+			extraMasks[i]->saveEGSPhantFile(extraNames[i]+"_mask.egsphant", &nativeGrid);
+			delete extraMasks[i];
+		}
+		extraMasks.clear();
 		duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
 		std::cout << "Masks successfully output.  Time elapsed is " << duration << " s.\n";
 	}
@@ -918,46 +1340,70 @@ int main(int argc, char **argv) {
 	/*
 	In this section, we simply output images using the prebuilt
 	image functions in the egsphant class.  There is also an
-	additional step in drawing the structure points overtop of the
-	media images.
+	additional step in drawing the structure outlines overtop of the
+	media images.  Each slice is a job, rendered and saved in
+	parallel.  DRRs and MIPs are then projected through the
+	whole phantom if requested.
 	*/
 	
 	double xi = (phant.x[0]+phant.x[1])/2.0;
 	double xf = (phant.x[phant.nx-1]+phant.x[phant.nx])/2.0;
 	double yi = (phant.y[0]+phant.y[1])/2.0;
 	double yf = (phant.y[phant.ny-1]+phant.y[phant.ny])/2.0;
-	double z;
-	double res = 10.0/xySpacing[0][0]*2; // This sets resolution to be 2 pixels for each voxel in x
-	QImage temp;
-	QList <QPointF> tempF;
-	QList<QPointF>::iterator tempIt;
-	QPen pen;
-	pen.setWidth(2);
+	double width = phant.x[1]-phant.x[0]; // Merged planes are wider, so go by the narrowest voxel in x
+	for (int i = 1; i < phant.nx; i++)
+		width = qMin(width, phant.x[i+1]-phant.x[i]);
+	double res = 2.0/width; // This sets resolution to be 2 pixels for each voxel in x
 	if (outputImages) {
+		// Image row r shows egsphant y of yi+(rows-1-r)/res, that is CT y of
+		// yMirror less that, so outlines only need shifting and scaling
+		double rowY = double(int((yf-yi)*res)-1)/res+yi-yMirror;
+		QVector <SliceImageJob> jobs(phant.nz);
 		for (int i = 0; i < phant.nz; i++) {
-			z = imagePos[i][2]/10.0;
-			phant.getEGSPhantPicDen("z axis", yi, yf, xi, xf, z, res).save(QString("Image/DenPic")+QString::number(i+1)+".png");
+			jobs[i].phant = &phant;
+			jobs[i].z = zMid = (phant.z[i]+phant.z[i+1])/2.0;
+			jobs[i].xi = xi; jobs[i].xf = xf;
+			jobs[i].yi = yi; jobs[i].yf = yf;
+			jobs[i].res = res;
+			jobs[i].denPath = QString("Image/DenPic")+QString::number(i+1)+".png";
+			jobs[i].medPath = QString("Image/MedPic")+QString::number(i+1)+".png";
 			
-			temp = phant.getEGSPhantPicMed("z axis", yi, yf, xi, xf, z, res);
-			QPainter paint (&temp);
 			for (int j = 0; j < structZ.size(); j++)
-				for (int k = 0; k < structZ[j].size(); k++) {
-					zMid = (phant.z[i]+phant.z[i+1])/2.0;
-					pen.setColor(QColor(double(j)/double(structZ.size())*255.0,0,255.0-double(j)/double(structZ.size())*255.0));
-					paint.setPen(pen);
+				for (int k = 0; k < structZ[j].size(); k++)
 					if (abs(structZ[j][k] - zMid) < (phant.z[i+1]-phant.z[i])/2.0) {
-						tempF = structPos[j][k].toList();
-						for (tempIt = tempF.begin(); tempIt != tempF.end(); tempIt++)
-							paint.drawPoint(phant.getIndex("x axis", tempIt->x())*2, phant.getIndex("y axis", tempIt->y())*2);
+						QPolygonF outline(structPos[j][k].size());
+						for (int p = 0; p < outline.size(); p++)
+							outline[p] = QPointF((structPos[j][k][p].x()-xi)*res, (structPos[j][k][p].y()+rowY)*res);
+						jobs[i].outlines << outline;
+						jobs[i].colours << QColor(double(j)/double(structZ.size())*255.0,0,255.0-double(j)/double(structZ.size())*255.0);
 					}
-				}
-			temp.save(QString("Image/MedPic")+QString::number(i+1)+".png");
 		}
 		
+		int failed = saveSliceImages(jobs);
+		if (failed)
+			std::cout << "Could not save the images of " << failed << " slices to the Image folder.\n";
+		
 		duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
 		std::cout << "Image data successfully output.  Time elapsed is " << duration << " s.\n";
 	}
 	
+	if (outputDRR && drrSize > 0) {
+		Projector drr(&phant, Projector::DRR), mip(&phant, Projector::MIP);
+		QVector <float> image;
+		QString view[2] = {"AP", "LAT"};
+		Axis beam[2] = {YAxis, XAxis};
+		for (int i = 0; i < 2; i++) {
+			ProjectionGeometry geom = Projector::facing(&phant, beam[i], drrSize, 100, 150);
+			drr.render(geom, &image);
+			Projector::savePGM("DRR_"+view[i]+".pgm", image, drrSize, drrSize);
+			mip.render(geom, &image);
+			Projector::savePGM("MIP_"+view[i]+".pgm", image, drrSize, drrSize);
+		}
+		
+		duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+		std::cout << "DRRs and MIPs successfully output.  Time elapsed is " << duration << " s.\n";
+	}
+	
 	// ---------------------------------------------------------- //
 	// CLEAR MEMORY ALLOCATIONS                                   //
 	// ---------------------------------------------------------- //
@@ -975,4 +1421,4 @@ int main(int argc, char **argv) {
     dicom.clear();
 	dicomExtra.clear();
     return 1;
-}
\ No newline at end of file
+}
\ No newline at end of file
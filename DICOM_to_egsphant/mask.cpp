@@ -0,0 +1,363 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "mask.h"
+
+// Merge two sorted lists of [start,end) runs, keeping the voxels in either
+static QVector <int> uniteRuns(const QVector <int> &a, const QVector <int> &b) {
+    QVector <int> out;
+    int i = 0, j = 0, start, end;
+    while (i < a.size() || j < b.size()) {
+        // Take whichever run starts first
+        if (j >= b.size() || (i < a.size() && a[i] <= b[j])) {
+            start = a[i]; end = a[i+1]; i += 2;
+        }
+        else {
+            start = b[j]; end = b[j+1]; j += 2;
+        }
+
+        // and extend the last run if they touch
+        if (out.size() && start <= out.last())
+            out.last() = end > out.last() ? end : out.last();
+        else
+            out << start << end;
+    }
+    return out;
+}
+
+// Keep only the voxels in both lists of runs
+static QVector <int> intersectRuns(const QVector <int> &a, const QVector <int> &b) {
+    QVector <int> out;
+    int i = 0, j = 0, start, end;
+    while (i < a.size() && j < b.size()) {
+        start = a[i] > b[j] ? a[i] : b[j];
+        end = a[i+1] < b[j+1] ? a[i+1] : b[j+1];
+        if (start < end)
+            out << start << end;
+
+        // Move on from whichever run ends first
+        if (a[i+1] < b[j+1])
+            i += 2;
+        else
+            j += 2;
+    }
+    return out;
+}
+
+// Keep only the voxels of a that are not in b
+static QVector <int> subtractRuns(const QVector <int> &a, const QVector <int> &b) {
+    QVector <int> out;
+    int j = 0, start, end;
+    for (int i = 0; i < a.size(); i += 2) {
+        start = a[i];
+        end = a[i+1];
+
+        // Skip the runs of b that end before this one, then cut out the rest
+        while (j < b.size() && b[j+1] <= start)
+            j += 2;
+        for (int l = j; l < b.size() && b[l] < end; l += 2) {
+            if (b[l] > start)
+                out << start << b[l];
+            start = b[l+1] > start ? b[l+1] : start;
+        }
+        if (start < end)
+            out << start << end;
+    }
+    return out;
+}
+
+Mask::Mask(int x, int y, int z) {
+    nx = x;
+    ny = y;
+    nz = z;
+    slices.fill(NULL, nz);
+}
+
+Mask::Mask(const Mask &other) {
+    nx = ny = nz = 0;
+    *this = other;
+}
+
+Mask::~Mask() {
+    clear();
+}
+
+Mask &Mask::operator=(const Mask &other) {
+    if (this == &other)
+        return *this;
+
+    clear();
+    nx = other.nx;
+    ny = other.ny;
+    nz = other.nz;
+    slices.fill(NULL, nz);
+    for (int k = 0; k < nz; k++)
+        if (other.slices[k] != NULL)
+            slices[k] = new MaskSlice(*other.slices[k]);
+    return *this;
+}
+
+void Mask::clear() {
+    for (int k = 0; k < slices.size(); k++)
+        if (slices[k] != NULL)
+            delete slices[k];
+    slices.clear();
+}
+
+// Go back to bits so that slice k can be changed
+void Mask::expand(int k) {
+    if (slices[k] == NULL) {
+        slices[k] = new MaskSlice;
+        slices[k]->bits.fill(0, ((unsigned long int)nx*ny+63)/64);
+        return;
+    }
+    if (slices[k]->bits.size())
+        return;
+
+    MaskSlice *slice = slices[k];
+    slice->bits.fill(0, ((unsigned long int)nx*ny+63)/64);
+    for (int j = 0; j < slice->runs.size(); j++)
+        for (int r = 0; r < slice->runs[j].size(); r += 2)
+            for (int i = slice->runs[j][r]; i < slice->runs[j][r+1]; i++) {
+                unsigned long int n = (unsigned long int)j*nx+i;
+                slice->bits[n >> 6] |= (quint64)1 << (n & 63);
+            }
+    slice->runs.clear();
+}
+
+void Mask::set(int i, int j, int k) {
+    if (i < 0 || i >= nx || j < 0 || j >= ny || k < 0 || k >= nz)
+        return;
+
+    expand(k);
+    unsigned long int n = (unsigned long int)j*nx+i;
+    slices[k]->bits[n >> 6] |= (quint64)1 << (n & 63);
+}
+
+bool Mask::test(int i, int j, int k) const {
+    if (i < 0 || i >= nx || j < 0 || j >= ny || k < 0 || k >= nz || slices[k] == NULL)
+        return false;
+
+    MaskSlice *slice = slices[k];
+    if (slice->bits.size()) {
+        unsigned long int n = (unsigned long int)j*nx+i;
+        return (slice->bits[n >> 6] >> (n & 63)) & 1;
+    }
+
+    // Find the last run that starts at or before i
+    const QVector <int> &runs = slice->runs[j];
+    int lo = 0, hi = runs.size()/2-1, mid;
+    while (lo <= hi) {
+        mid = (lo+hi)/2;
+        if (runs[2*mid] <= i)
+            lo = mid+1;
+        else
+            hi = mid-1;
+    }
+    return hi >= 0 && i < runs[2*hi+1];
+}
+
+// The runs of row j of slice k, whichever way the slice is held
+QVector <int> Mask::rowRuns(int j, int k) const {
+    QVector <int> runs;
+    if (slices[k] == NULL)
+        return runs;
+    if (!slices[k]->bits.size())
+        return slices[k]->runs[j];
+
+    const QVector <quint64> &bits = slices[k]->bits;
+    bool in = false;
+    for (int i = 0; i < nx; i++) {
+        unsigned long int n = (unsigned long int)j*nx+i;
+        if (((bits[n >> 6] >> (n & 63)) & 1) != in) {
+            runs << i;
+            in = !in;
+        }
+    }
+    if (in)
+        runs << nx;
+    return runs;
+}
+
+void Mask::compress(int k) {
+    if (slices[k] == NULL || !slices[k]->bits.size())
+        return;
+
+    QVector <QVector <int> > runs(ny);
+    bool empty = true;
+    for (int j = 0; j < ny; j++) {
+        runs[j] = rowRuns(j, k);
+        if (runs[j].size())
+            empty = false;
+    }
+
+    // Drop slices that were expanded but never had anything set
+    if (empty) {
+        delete slices[k];
+        slices[k] = NULL;
+        return;
+    }
+    slices[k]->runs = runs;
+    slices[k]->bits.clear();
+}
+
+void Mask::compress() {
+    for (int k = 0; k < nz; k++)
+        compress(k);
+}
+
+unsigned long int Mask::count() const {
+    unsigned long int total = 0;
+    QVector <int> runs;
+    for (int k = 0; k < nz; k++)
+        if (slices[k] != NULL)
+            for (int j = 0; j < ny; j++) {
+                runs = rowRuns(j, k);
+                for (int r = 0; r < runs.size(); r += 2)
+                    total += runs[r+1]-runs[r];
+            }
+    return total;
+}
+
+int Mask::unite(const Mask &other) {
+    if (nx != other.nx || ny != other.ny || nz != other.nz)
+        return 0;
+
+    for (int k = 0; k < nz; k++) {
+        if (other.slices[k] == NULL)
+            continue;
+
+        QVector <QVector <int> > runs(ny);
+        for (int j = 0; j < ny; j++)
+            runs[j] = uniteRuns(rowRuns(j, k), other.rowRuns(j, k));
+
+        if (slices[k] == NULL)
+            slices[k] = new MaskSlice;
+        slices[k]->runs = runs;
+        slices[k]->bits.clear();
+    }
+    return 1;
+}
+
+int Mask::intersect(const Mask &other) {
+    if (nx != other.nx || ny != other.ny || nz != other.nz)
+        return 0;
+
+    for (int k = 0; k < nz; k++) {
+        if (slices[k] == NULL)
+            continue;
+
+        QVector <QVector <int> > runs(ny);
+        bool empty = true;
+        if (other.slices[k] != NULL)
+            for (int j = 0; j < ny; j++) {
+                runs[j] = intersectRuns(rowRuns(j, k), other.rowRuns(j, k));
+                if (runs[j].size())
+                    empty = false;
+            }
+
+        if (empty) {
+            delete slices[k];
+            slices[k] = NULL;
+            continue;
+        }
+        slices[k]->runs = runs;
+        slices[k]->bits.clear();
+    }
+    return 1;
+}
+
+int Mask::subtract(const Mask &other) {
+    if (nx != other.nx || ny != other.ny || nz != other.nz)
+        return 0;
+
+    for (int k = 0; k < nz; k++) {
+        if (slices[k] == NULL || other.slices[k] == NULL)
+            continue;
+
+        QVector <QVector <int> > runs(ny);
+        bool empty = true;
+        for (int j = 0; j < ny; j++) {
+            runs[j] = subtractRuns(rowRuns(j, k), other.rowRuns(j, k));
+            if (runs[j].size())
+                empty = false;
+        }
+
+        if (empty) {
+            delete slices[k];
+            slices[k] = NULL;
+            continue;
+        }
+        slices[k]->runs = runs;
+        slices[k]->bits.clear();
+    }
+    return 1;
+}
+
+int Mask::saveEGSPhantFile(QString path, EGSPhant *grid) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        std::cout << "Could not open " << path.toStdString() << " for writing, quitting...\n";
+        return 0;
+    }
+
+    QTextStream output(&file);
+
+    // Same header as EGSPhant::saveEGSPhantFile, with the two mask media
+    output << 2 << "\n" << "OTHER" << "\n" << "TARGET" << "\n";
+    output << "0.50 0.50 " << "\n";
+    output << nx << " " << ny << " " << nz << "\n";
+    for (int i = 0; i <= nx; i++)
+        output << grid->x[i] << " ";
+    output << "\n";
+    for (int i = 0; i <= ny; i++)
+        output << grid->y[i] << " ";
+    output << "\n";
+    for (int i = 0; i <= nz; i++)
+        output << grid->z[i] << " ";
+    output << "\n";
+
+    output.flush();
+
+    // Media, each row is built from its runs and each slice written at once
+    QByteArray slice((nx+1)*ny+1, '\n');
+    QVector <int> runs;
+    char *row;
+    for (int k = 0; k < nz; k++) {
+        for (int j = 0; j < ny; j++) {
+            runs = rowRuns(j, k);
+            row = slice.data()+j*(nx+1);
+            memset(row, '1', nx);
+            for (int r = 0; r < runs.size(); r += 2)
+                memset(row+runs[r], '2', runs[r+1]-runs[r]);
+        }
+        file.write(slice);
+    }
+    file.write("\n");
+
+    // Densities are all 0, so every slice is the same
+    QByteArray zeros;
+    zeros.reserve((2*nx+1)*ny+1);
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++)
+            zeros += "0 ";
+        zeros += '\n';
+    }
+    zeros += '\n';
+    for (int k = 0; k < nz; k++)
+        file.write(zeros);
+
+    file.close();
+    return 1;
+}
@@ -0,0 +1,65 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef MASK_H
+#define MASK_H
+
+#include "egsphant.h"
+
+// One slice of a mask, either one bit per voxel while it is being filled in
+// or a list of [start,end) runs of voxels for each row once it is compressed
+struct MaskSlice {
+    QVector <quint64> bits;
+    QVector <QVector <int> > runs;
+};
+
+// A binary mask over an nx by ny by nz grid, slices without any voxels in
+// them take no memory at all
+class Mask {
+public:
+    Mask(int x = 0, int y = 0, int z = 0);
+    Mask(const Mask &other);
+    ~Mask();
+    Mask &operator=(const Mask &other);
+
+    int nx, ny, nz; // these hold the number of voxels
+
+    void set(int i, int j, int k);
+    bool test(int i, int j, int k) const;
+    unsigned long int count() const;
+
+    // Turn bit slices into runs, which is all that is kept of a finished slice
+    void compress(int k);
+    void compress();
+
+    // Combine other (which must have the same dimensions) into this
+    int unite(const Mask &other);
+    int intersect(const Mask &other);
+    int subtract(const Mask &other);
+
+    // The [start,end) runs of voxels of row j of slice k
+    QVector <int> rowRuns(int j, int k) const;
+
+    // Write the mask as an egsphant with media OTHER (1) and TARGET (2) over
+    // the boundaries of grid, one row at a time
+    int saveEGSPhantFile(QString path, EGSPhant *grid);
+
+private:
+    QVector <MaskSlice*> slices; // NULL if the slice is empty
+
+    void clear();
+    void expand(int k);
+};
+
+#endif
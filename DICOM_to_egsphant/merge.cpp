@@ -0,0 +1,113 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "merge.h"
+
+// Position in the volumes of voxel (u,v) of plane p along axis
+static inline unsigned long int planeVoxel(const Volume <char> &m, Axis axis, int p, int u, int v) {
+    if (axis == XAxis)
+        return m.index(p, u, v);
+    else if (axis == YAxis)
+        return m.index(u, p, v);
+    return m.index(u, v, p);
+}
+
+// Whether plane c can be merged into the run starting at plane r
+static bool samePlane(EGSPhant *phant, Axis axis, int r, int c, double tolerance) {
+    int nu = axis == XAxis ? phant->ny : phant->nx, nv = axis == ZAxis ? phant->ny : phant->nz;
+    const char *m = phant->m.data();
+    const double *d = phant->d.data();
+    unsigned long int a, b;
+    for (int v = 0; v < nv; v++)
+        for (int u = 0; u < nu; u++) {
+            a = planeVoxel(phant->m, axis, r, u, v);
+            b = planeVoxel(phant->m, axis, c, u, v);
+            if (m[a] != m[b] || fabs(d[b]-d[a]) > tolerance*d[a])
+                return false;
+        }
+    return true;
+}
+
+int mergePlanes(EGSPhant *phant, Axis axis, const QVector <bool> &keep, double tolerance) {
+    QVector <double> &b = axis == XAxis ? phant->x : (axis == YAxis ? phant->y : phant->z);
+    int n = b.size()-1;
+
+    // Find the runs, group[p] being the new plane of old plane p
+    QVector <int> group(n);
+    QVector <double> merged;
+    merged << b[0];
+    int count = 0;
+    for (int s = 0, e; s < n; s = e, count++) {
+        e = s+1;
+        if (!(s < keep.size() && keep[s]))
+            while (e < n && !(e < keep.size() && keep[e]) && samePlane(phant, axis, s, e, tolerance))
+                e++;
+        for (int p = s; p < e; p++)
+            group[p] = count;
+        merged << b[e];
+    }
+    if (count == n)
+        return n;
+
+    // Add up the mass of each merged voxel, and divide by its width after
+    int mx = axis == XAxis ? count : phant->nx;
+    int my = axis == YAxis ? count : phant->ny;
+    int mz = axis == ZAxis ? count : phant->nz;
+    Volume <char> m;
+    Volume <double> d;
+    if (!m.resize(mx, my, mz, 0) || !d.resize(mx, my, mz, 0))
+        return -1;
+    int gi, gj, gk;
+    double w;
+    for (int k = 0; k < phant->nz; k++) {
+        gk = axis == ZAxis ? group[k] : k;
+        for (int j = 0; j < phant->ny; j++) {
+            gj = axis == YAxis ? group[j] : j;
+            for (int i = 0; i < phant->nx; i++) {
+                gi = axis == XAxis ? group[i] : i;
+                w = axis == XAxis ? b[i+1]-b[i] : (axis == YAxis ? b[j+1]-b[j] : b[k+1]-b[k]);
+                m(gi,gj,gk) = phant->m(i,j,k);
+                d(gi,gj,gk) += phant->d(i,j,k)*w;
+            }
+        }
+    }
+    for (int k = 0; k < mz; k++)
+        for (int j = 0; j < my; j++)
+            for (int i = 0; i < mx; i++) {
+                w = axis == XAxis ? merged[i+1]-merged[i] :
+                    (axis == YAxis ? merged[j+1]-merged[j] : merged[k+1]-merged[k]);
+                d(i,j,k) /= w;
+            }
+
+    phant->m.swap(m);
+    phant->d.swap(d);
+    phant->nx = mx;
+    phant->ny = my;
+    phant->nz = mz;
+    b = merged;
+    phant->updateGrid();
+    return count;
+}
+
+void keepPlanes(const QVector <double> &b, double lo, double hi, double margin, QVector <bool> *keep) {
+    int n = b.size()-1;
+    if (keep->size() != n)
+        keep->fill(false, n);
+    if (lo > hi)
+        return;
+
+    for (int p = 0; p < n; p++)
+        if (b[p+1] > lo-margin && b[p] < hi+margin)
+            (*keep)[p] = true;
+}
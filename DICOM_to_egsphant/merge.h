@@ -0,0 +1,32 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef MERGE_H
+#define MERGE_H
+
+#include "egsphant.h"
+
+// Merges runs of neighbouring planes of voxels along axis into single planes
+// wherever every voxel of a plane has the same medium as the first plane of
+// the run and a density within tolerance (relative) of it, planes flagged in
+// keep are never merged, merged densities are mass weighted, that is
+// weighted by voxel width, returns the number of planes left (or -1, leaving
+// phant as it was, if there is not enough memory)
+int mergePlanes(EGSPhant *phant, Axis axis, const QVector <bool> &keep, double tolerance);
+
+// Flag the planes along boundaries b that come within margin of the range
+// lo to hi (all in cm), so that they can be passed to mergePlanes as keep
+void keepPlanes(const QVector <double> &b, double lo, double hi, double margin, QVector <bool> *keep);
+
+#endif
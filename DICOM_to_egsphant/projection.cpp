@@ -0,0 +1,168 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "projection.h"
+
+static void traceProjectionRow(ProjectionJob &job) {
+    job.projector->traceRow(job);
+}
+
+Projector::Projector(EGSPhant *p, Mode m) {
+    phant = p;
+    mode = m;
+}
+
+double Projector::trace(const double *s, const double *dir) const {
+    const QVector <double> *b[3] = {&phant->x, &phant->y, &phant->z};
+    int n[3] = {phant->nx, phant->ny, phant->nz};
+    if (!n[0] || !n[1] || !n[2])
+        return 0;
+
+    // Where the ray enters and leaves the phantom, as fractions of dir
+    double aMin = 0, aMax = 1, a0, a1;
+    for (int l = 0; l < 3; l++) {
+        if (dir[l] == 0) {
+            if (s[l] <= b[l]->first() || s[l] >= b[l]->last())
+                return 0;
+            continue;
+        }
+        a0 = (b[l]->first()-s[l])/dir[l];
+        a1 = (b[l]->last()-s[l])/dir[l];
+        aMin = qMax(aMin, qMin(a0, a1));
+        aMax = qMin(aMax, qMax(a0, a1));
+    }
+    if (aMin >= aMax)
+        return 0;
+
+    // The voxel the ray enters, found half way to the first boundary it
+    // crosses, and the fraction at which it next crosses each axis
+    const GridAxis *g[3] = {&phant->gx, &phant->gy, &phant->gz};
+    int index[3], step[3];
+    double next[3], p;
+    for (int l = 0; l < 3; l++) {
+        p = s[l]+aMin*dir[l];
+        index[l] = g[l]->lower(p);
+        if (index[l] < 0)
+            index[l] = p < b[l]->first() ? 0 : n[l]-1;
+        if (dir[l] > 0 && index[l] < n[l]-1 && p >= (*b[l])[index[l]+1])
+            index[l]++;
+        else if (dir[l] < 0 && index[l] > 0 && p <= (*b[l])[index[l]])
+            index[l]--;
+
+        step[l] = dir[l] > 0 ? 1 : -1;
+        next[l] = dir[l] == 0 ? 2 : ((*b[l])[index[l]+(dir[l] > 0)]-s[l])/dir[l];
+    }
+
+    double length = sqrt(dir[0]*dir[0]+dir[1]*dir[1]+dir[2]*dir[2]);
+    double a = aMin, aNext, value = 0, density;
+    int l;
+    while (a < aMax) {
+        l = next[0] < next[1] ? (next[0] < next[2] ? 0 : 2) : (next[1] < next[2] ? 1 : 2);
+        aNext = qMin(next[l], aMax);
+
+        density = phant->d(index[0], index[1], index[2]);
+        if (mode == DRR)
+            value += density*(aNext-a)*length;
+        else if (density > value)
+            value = density;
+
+        a = aNext;
+        index[l] += step[l];
+        if (index[l] < 0 || index[l] >= n[l])
+            break;
+        next[l] = ((*b[l])[index[l]+(step[l] > 0)]-s[l])/dir[l];
+    }
+    return value;
+}
+
+void Projector::traceRow(ProjectionJob &job) const {
+    const ProjectionGeometry &geom = *job.geom;
+    double dir[3];
+    for (int i = 0; i < geom.width; i++) {
+        for (int l = 0; l < 3; l++)
+            dir[l] = geom.origin[l]+i*geom.u[l]+job.j*geom.v[l]-geom.source[l];
+        job.row[i] = trace(geom.source, dir);
+    }
+}
+
+double Projector::render(const ProjectionGeometry &geom, QVector <float> *image) const {
+    image->fill(0, geom.width*geom.height);
+
+    QVector <ProjectionJob> jobs(geom.height);
+    for (int j = 0; j < geom.height; j++) {
+        jobs[j].projector = this;
+        jobs[j].geom = &geom;
+        jobs[j].row = image->data()+j*geom.width;
+        jobs[j].j = j;
+    }
+    QtConcurrent::blockingMap(jobs, traceProjectionRow);
+
+    double max = 0;
+    for (int n = 0; n < image->size(); n++)
+        if ((*image)[n] > max)
+            max = (*image)[n];
+    return max;
+}
+
+ProjectionGeometry Projector::facing(const EGSPhant *p, Axis axis, int size, double sad, double sid) {
+    ProjectionGeometry geom;
+    double lo[3] = {p->x.first(), p->y.first(), p->z.first()};
+    double hi[3] = {p->x.last(), p->y.last(), p->z.last()};
+
+    // The beam runs along axis a, the detector rows along b and columns along c
+    int a = axis, b = axis == XAxis ? 1 : 0, c = axis == ZAxis ? 1 : 2;
+    double center[3], extent = qMax(hi[b]-lo[b], hi[c]-lo[c])*sid/sad;
+    for (int l = 0; l < 3; l++) {
+        center[l] = (lo[l]+hi[l])/2.0;
+        geom.source[l] = center[l];
+        geom.u[l] = geom.v[l] = 0;
+    }
+    geom.source[a] -= sad;
+
+    geom.width = geom.height = size;
+    geom.u[b] = extent/size;
+    geom.v[c] = extent/size;
+    for (int l = 0; l < 3; l++)
+        geom.origin[l] = geom.source[l];
+    geom.origin[a] += sid;
+    geom.origin[b] = center[b]-extent/2.0+geom.u[b]/2.0;
+    geom.origin[c] = center[c]-extent/2.0+geom.v[c]/2.0;
+    return geom;
+}
+
+int Projector::savePGM(QString path, const QVector <float> &image, int width, int height, double max) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        std::cout << "Could not open " << path.toStdString() << " for writing, quitting...\n";
+        return 0;
+    }
+
+    if (max <= 0)
+        for (int n = 0; n < image.size(); n++)
+            max = image[n] > max ? image[n] : max;
+    double scale = max > 0 ? 65535.0/max : 0;
+
+    // The header is text, the pixels big endian 16 bit
+    file.write(QString("P5\n%1 %2\n65535\n").arg(width).arg(height).toLatin1());
+    QByteArray pixels(width*height*2, 0);
+    for (int n = 0; n < width*height; n++) {
+        double value = image[n]*scale;
+        unsigned short int level = value >= 65535 ? 65535 : (unsigned short int)(value+0.5);
+        pixels[2*n] = char(level >> 8);
+        pixels[2*n+1] = char(level & 0xFF);
+    }
+    file.write(pixels);
+    file.close();
+    return 1;
+}
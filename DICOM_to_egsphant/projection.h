@@ -0,0 +1,75 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef PROJECTION_H
+#define PROJECTION_H
+
+#include <QtConcurrent>
+#include "egsphant.h"
+
+// A point source and a flat detector, all in phantom coordinates (cm)
+struct ProjectionGeometry {
+    double source[3]; // the source position
+    double origin[3]; // the center of detector pixel (0,0)
+    double u[3], v[3]; // the step from one pixel to the next along a row and a column
+    int width, height; // the number of pixels
+};
+
+class Projector;
+
+// One detector row of a projection
+struct ProjectionJob {
+    const Projector *projector;
+    const ProjectionGeometry *geom;
+    float *row;
+    int j;
+};
+
+// Casts rays from the source through each detector pixel across the density
+// of an egsphant, stepping from voxel boundary to voxel boundary (Siddon's
+// method with Jacobs' incremental updates), so every voxel a ray crosses is
+// visited once whatever the voxel sizes
+class Projector {
+public:
+    // A DRR is the density times path length (g/cm^2) along each ray, a MIP
+    // the highest density along it
+    enum Mode {DRR, MIP};
+
+    Projector(EGSPhant *p, Mode m = DRR);
+
+    // Fill image (width*height, rows of width) with one value per pixel, rows
+    // are traced in parallel, returns the highest value
+    double render(const ProjectionGeometry &geom, QVector <float> *image) const;
+
+    // The value along the ray from s in direction dir, where s+dir is the
+    // far end of the ray
+    double trace(const double *s, const double *dir) const;
+
+    // A source sad cm from the phantom center facing down axis, with a
+    // detector sid cm from the source of size by size pixels, sized to take
+    // in the whole phantom
+    static ProjectionGeometry facing(const EGSPhant *p, Axis axis, int size, double sad, double sid);
+
+    // Write image as a 16 bit binary PGM, with max (or the highest value if
+    // max is 0) mapped to 65535
+    static int savePGM(QString path, const QVector <float> &image, int width, int height, double max = 0);
+
+    void traceRow(ProjectionJob &job) const;
+
+private:
+    EGSPhant *phant;
+    Mode mode;
+};
+
+#endif
@@ -0,0 +1,132 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#include <QtConcurrent>
+#include "volume.h"
+#include "grid.h"
+
+// The source voxels (and their weights) that make up each target voxel along
+// one axis, those of target voxel i are start[i] to start[i+1]-1
+struct ResampleAxis {
+    QVector <int> start;
+    QVector <int> index;
+    QVector <double> weight;
+};
+
+// Resamples volumes from one rectilinear grid onto another, the per axis
+// tables are worked out once and the target is then filled in one slice at a
+// time, in parallel, one axis after the other
+//
+// Overlap weighs each source voxel by the fraction of the target voxel it
+// covers, which keeps the integral of the volume exactly where the target
+// covers the source, the other modes sample at target voxel centers
+class Resampler {
+public:
+    enum Mode {Nearest, Trilinear, Cubic, Overlap};
+
+    Resampler(Mode m = Trilinear);
+
+    // Work out the tables from the source boundaries to the target ones
+    void setGrids(const QVector <double> &sx, const QVector <double> &sy, const QVector <double> &sz,
+                  const QVector <double> &tx, const QVector <double> &ty, const QVector <double> &tz);
+
+    // Fill out (0 outside the source) from src, which must match the source
+    // grid, out takes the dimensions of the target grid, returns false if
+    // there is not enough memory for it
+    template <class T> bool apply(const Volume <T> &src, Volume <T> *out) const;
+
+    // The table for the target voxels of dst within src
+    static ResampleAxis buildAxis(const QVector <double> &src, const QVector <double> &dst, Mode mode);
+
+private:
+    Mode mode;
+    ResampleAxis ax, ay, az;
+};
+
+// One target slice of a resample
+template <class T> struct ResampleJob {
+    const Volume <T> *src;
+    const ResampleAxis *ax, *ay, *az;
+    Volume <T> *out;
+    int k;
+};
+
+template <class T> void resampleSlice(ResampleJob <T> &job) {
+    const ResampleAxis &ax = *job.ax, &ay = *job.ay, &az = *job.az;
+    int snx = job.src->sizeX(), sny = job.src->sizeY(), k = job.k;
+    double w;
+
+    // Collapse the source slices this target slice needs onto one plane
+    if (az.start[k] == az.start[k+1])
+        return; // The target slice is outside the source, and already 0
+    job.src->prefetch(az.index[az.start[k]], az.index[az.start[k+1]-1]+1); // Mapped sources
+    QVector <double> plane(snx*sny, 0), row(snx, 0);
+    for (int t = az.start[k]; t < az.start[k+1]; t++) {
+        w = az.weight[t];
+        const T *s = job.src->slice(az.index[t]);
+        for (int n = 0; n < snx*sny; n++)
+            plane[n] += w*s[n];
+    }
+
+    const int *index = ax.index.constData();
+    const double *weight = ax.weight.constData();
+    double value;
+    for (int j = 0; j < job.out->sizeY(); j++) {
+        // then the plane onto one row,
+        if (ay.start[j] == ay.start[j+1])
+            continue;
+        row.fill(0);
+        for (int t = ay.start[j]; t < ay.start[j+1]; t++) {
+            w = ay.weight[t];
+            const double *p = plane.constData()+ay.index[t]*snx;
+            for (int i = 0; i < snx; i++)
+                row[i] += w*p[i];
+        }
+
+        // and the row onto each target voxel
+        T *o = job.out->row(j, k);
+        for (int i = 0; i < job.out->sizeX(); i++) {
+            value = 0;
+            for (int t = ax.start[i]; t < ax.start[i+1]; t++)
+                value += weight[t]*row[index[t]];
+            o[i] = value;
+        }
+    }
+}
+
+template <class T> bool Resampler::apply(const Volume <T> &src, Volume <T> *out) const {
+    int nx = ax.start.size()-1, ny = ay.start.size()-1, nz = az.start.size()-1;
+    if (!out->resize(nx > 0 ? nx : 0, ny > 0 ? ny : 0, nz > 0 ? nz : 0, 0))
+        return false;
+    if (src.isEmpty() || out->isEmpty())
+        return true;
+
+    QVector <ResampleJob <T> > jobs(nz);
+    for (int k = 0; k < nz; k++) {
+        jobs[k].src = &src;
+        jobs[k].ax = &ax;
+        jobs[k].ay = &ay;
+        jobs[k].az = &az;
+        jobs[k].out = out;
+        jobs[k].k = k;
+    }
+
+    QtConcurrent::blockingMap(jobs, resampleSlice <T>);
+    return true;
+}
+
+#endif
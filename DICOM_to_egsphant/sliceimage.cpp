@@ -0,0 +1,44 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "sliceimage.h"
+
+void renderSliceImages(SliceImageJob &job) {
+    QImage image = job.phant->getEGSPhantPicDen("z axis", job.yi, job.yf, job.xi, job.xf, job.z, job.res);
+    job.saved = image.save(job.denPath);
+
+    image = job.phant->getEGSPhantPicMed("z axis", job.yi, job.yf, job.xi, job.xf, job.z, job.res);
+    if (job.outlines.size()) {
+        QPainter paint(&image);
+        QPen pen;
+        pen.setWidth(2);
+        paint.setBrush(Qt::NoBrush);
+        for (int n = 0; n < job.outlines.size(); n++) {
+            pen.setColor(job.colours[n]);
+            paint.setPen(pen);
+            paint.drawPolygon(job.outlines[n]);
+        }
+    }
+    job.saved = image.save(job.medPath) && job.saved;
+}
+
+int saveSliceImages(QVector <SliceImageJob> &jobs) {
+    QtConcurrent::blockingMap(jobs, renderSliceImages);
+
+    int failed = 0;
+    for (int n = 0; n < jobs.size(); n++)
+        if (!jobs[n].saved)
+            failed++;
+    return failed;
+}
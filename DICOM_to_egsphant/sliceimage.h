@@ -0,0 +1,39 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef SLICEIMAGE_H
+#define SLICEIMAGE_H
+
+#include <QtConcurrent>
+#include "egsphant.h"
+
+// The density and media images of one z slice of an egsphant, with structure
+// outlines drawn over the media image
+struct SliceImageJob {
+    EGSPhant *phant;
+    double z; // the slice (cm)
+    double xi, xf, yi, yf, res; // the extent (cm) and resolution (pixels/cm) of the images
+    QVector <QPolygonF> outlines; // closed structure outlines, in image pixels
+    QVector <QColor> colours; // the colour of each outline
+    QString denPath, medPath; // where to save the images
+    bool saved;
+};
+
+// Draw and save every job, slices being rendered and PNG encoded in parallel,
+// returns the number of jobs whose images could not both be saved
+int saveSliceImages(QVector <SliceImageJob> &jobs);
+
+void renderSliceImages(SliceImageJob &job);
+
+#endif
@@ -0,0 +1,124 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef TEXTNUMBER_H
+#define TEXTNUMBER_H
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// Write v into out exactly as QTextStream << v does by default (6 significant
+// digits, trailing zeros dropped, exponent form below 1e-4 and from 1e6, ties
+// rounded away from zero, -0 as 0), returns the number of characters, out
+// needs room for 16
+inline int formatNumber(double v, char *out) {
+    static const double pow10[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    char *p = out;
+    if (v != v) {
+        memcpy(out, "nan", 3);
+        return 3;
+    }
+    if (v < 0) {
+        *(p++) = '-';
+        v = -v;
+    }
+    if (v == 0) {
+        out[0] = '0';
+        return 1;
+    }
+    if (v > 1.7976931348623157e308) {
+        memcpy(p, "inf", 3);
+        return p-out+3;
+    }
+
+    // Scale to six digits before the point, the powers of ten are exact so
+    // the scaled value is off by at most half an ulp
+    int e = int(floor(log10(v))), n = -1;
+    double scaled = 0;
+    for (int tries = 0; tries < 2 && e >= -17 && e <= 27; tries++) {
+        scaled = e <= 5 ? v*pow10[5-e] : v/pow10[e-5];
+        if (scaled < 1e5)
+            e--;
+        else if (scaled >= 1e6)
+            e++;
+        else {
+            double whole = floor(scaled), frac = scaled-whole;
+            if (fabs(frac-0.5) > 1e-9)
+                n = int(whole)+(frac > 0.5);
+            break;
+        }
+    }
+
+    // Otherwise (huge, tiny or too close to a tie to tell) work from the
+    // exact decimal digits
+    if (n < 0) {
+        char digits[64];
+        snprintf(digits, sizeof(digits), "%.40e", v);
+        n = 0;
+        for (int i = 0; i < 7; i++)
+            n = n*10+(digits[i == 0 ? 0 : i+1]-'0');
+        e = atoi(digits+43);
+        n = n/10+(n%10 >= 5);
+    }
+    if (n >= 1000000) {
+        n /= 10;
+        e++;
+    }
+
+    // The six digits, less trailing zeros
+    char d[6];
+    int count = 6;
+    for (int i = 5; i >= 0; i--, n /= 10)
+        d[i] = '0'+n%10;
+    while (count > 1 && d[count-1] == '0')
+        count--;
+
+    if (e < -4 || e >= 6) {
+        *(p++) = d[0];
+        if (count > 1) {
+            *(p++) = '.';
+            for (int i = 1; i < count; i++)
+                *(p++) = d[i];
+        }
+        *(p++) = 'e';
+        *(p++) = e < 0 ? '-' : '+';
+        e = e < 0 ? -e : e;
+        if (e >= 100)
+            *(p++) = '0'+e/100;
+        *(p++) = '0'+(e/10)%10;
+        *(p++) = '0'+e%10;
+    }
+    else if (e < 0) {
+        *(p++) = '0';
+        *(p++) = '.';
+        for (int i = -1; i > e; i--)
+            *(p++) = '0';
+        for (int i = 0; i < count; i++)
+            *(p++) = d[i];
+    }
+    else {
+        for (int i = 0; i <= e; i++)
+            *(p++) = i < count ? d[i] : '0';
+        if (count > e+1) {
+            *(p++) = '.';
+            for (int i = e+1; i < count; i++)
+                *(p++) = d[i];
+        }
+    }
+    return p-out;
+}
+
+#endif
@@ -0,0 +1,136 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef TEXTREADER_H
+#define TEXTREADER_H
+
+#include <QtCore>
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+
+inline bool isTextSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+}
+
+// Parse the number in s to end (a whole token) into v without allocating,
+// numbers of up to 19 digits with small enough exponents are exact in double
+// arithmetic, the rest go through strtod, returns false if the token is not a
+// number
+inline bool parseNumber(const char *s, const char *end, double *v) {
+    static const double pow10[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const char *p = s;
+    bool negative = false, digits = false, exact = true;
+    if (p < end && (*p == '-' || *p == '+'))
+        negative = *(p++) == '-';
+
+    // Up to 19 significant digits fit in mantissa, the power of ten goes in e
+    quint64 mantissa = 0;
+    int significant = 0, e = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; p++, digits = true)
+        if (significant < 19) {
+            mantissa = mantissa*10+(*p-'0');
+            significant += mantissa > 0;
+        }
+        else {
+            e++;
+            exact &= *p == '0';
+        }
+    if (p < end && *p == '.')
+        for (p++; p < end && *p >= '0' && *p <= '9'; p++, digits = true)
+            if (significant < 19) {
+                mantissa = mantissa*10+(*p-'0');
+                significant += mantissa > 0;
+                e--;
+            }
+            else
+                exact &= *p == '0';
+    if (digits && p < end && (*p == 'e' || *p == 'E')) {
+        bool negativeExp = false;
+        int exp = 0;
+        p++;
+        if (p < end && (*p == '-' || *p == '+'))
+            negativeExp = *(p++) == '-';
+        if (p == end || *p < '0' || *p > '9')
+            return false;
+        for (; p < end && *p >= '0' && *p <= '9'; p++)
+            exp = exp < 100000 ? exp*10+(*p-'0') : exp;
+        e += negativeExp ? -exp : exp;
+    }
+
+    if (digits && p == end && exact && mantissa <= (quint64(1) << 53) && e >= -22 && e <= 22) {
+        *v = e < 0 ? double(mantissa)/pow10[-e] : double(mantissa)*pow10[e];
+        *v = negative ? -*v : *v;
+        return true;
+    }
+
+    // Everything else (many digits, huge or tiny values, inf and nan), strtod
+    // rounds correctly but wants the decimal point of the current locale
+    char token[64];
+    if (end-s >= 64) {
+        bool ok;
+        *v = QByteArray(s, end-s).toDouble(&ok);
+        return ok;
+    }
+    memcpy(token, s, end-s);
+    token[end-s] = '\0';
+    char point = localeconv()->decimal_point[0];
+    if (point != '.' && (p = (const char*)memchr(token, '.', end-s)) != NULL)
+        token[p-token] = point;
+    char *stop;
+    *v = strtod(token, &stop);
+    return stop == token+(end-s) && stop != token;
+}
+
+// A text file (egsphant, 3ddose) mapped into memory, or read in whole if it
+// cannot be mapped, and read as whitespace separated tokens from the front,
+// long runs of numbers are split into chunks at whitespace which are counted
+// and then parsed in parallel straight into the output array
+class TextReader {
+public:
+    TextReader();
+    ~TextReader();
+
+    // Returns 0 if path cannot be opened
+    int open(QString path);
+    void close();
+
+    // The rest of the current line, less the line break
+    QByteArray readLine();
+
+    // Read the next count numbers into out, returns the number read, which is
+    // less than count if the file ends or a token is not a number
+    qint64 readNumbers(double *out, qint64 count);
+    qint64 readNumbers(float *out, qint64 count);
+    qint64 readNumbers(int *out, qint64 count);
+
+    // Read the next count characters that are not whitespace into out,
+    // returns the number read
+    qint64 readChars(char *out, qint64 count);
+
+    // Whether the last read stopped at the end of a token rather than part
+    // way through one, to check that a section ends where it should
+    bool atTokenEnd() const;
+
+private:
+    QFile file;
+    QByteArray buffer; // the file, if it could not be mapped
+    const char *text;
+    qint64 size, pos;
+
+    template <class T> qint64 readNumbersOf(T *out, qint64 count);
+};
+
+#endif
@@ -0,0 +1,428 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "voxelise.h"
+
+static void voxeliseSliceJob(VoxeliseJob &job) {
+    job.voxeliser->voxeliseSlice(job);
+}
+
+// The voxels along boundaries b that overlap lo to hi, first > last if none
+static void voxelRange(const QVector <double> &b, double lo, double hi, int *first, int *last) {
+    *first = int(std::upper_bound(b.constBegin(), b.constEnd(), lo)-b.constBegin())-1;
+    *last = int(std::lower_bound(b.constBegin(), b.constEnd(), hi)-b.constBegin())-1;
+    *first = *first < 0 ? 0 : *first;
+    *last = *last > b.size()-2 ? b.size()-2 : *last;
+}
+
+// The span of the line along x through y and z inside a sphere
+static bool sphereSpan(const double *c, double r, double y, double z, double *x0, double *x1) {
+    double q = r*r-(y-c[1])*(y-c[1])-(z-c[2])*(z-c[2]);
+    if (q < 0)
+        return false;
+    q = sqrt(q);
+    *x0 = c[0]-q;
+    *x1 = c[0]+q;
+    return true;
+}
+
+// The same for the cylinder of radius r about the segment a to b
+static bool cylinderSpan(const double *a, const double *b, double r, double y, double z, double *x0, double *x1) {
+    double u[3] = {b[0]-a[0], b[1]-a[1], b[2]-a[2]};
+    double L2 = u[0]*u[0]+u[1]*u[1]+u[2]*u[2];
+    if (L2 <= 0)
+        return false;
+
+    // Along the line, the point is w0 + t*(1,0,0) from a
+    double w0[3] = {-a[0], y-a[1], z-a[2]};
+    double wu = w0[0]*u[0]+w0[1]*u[1]+w0[2]*u[2];
+    double lo = -1e30, hi = 1e30;
+
+    // Between the end caps, 0 <= w.u <= L2
+    if (u[0] == 0) {
+        if (wu < 0 || wu > L2)
+            return false;
+    }
+    else {
+        lo = -wu/u[0];
+        hi = (L2-wu)/u[0];
+        if (lo > hi)
+            qSwap(lo, hi);
+    }
+
+    // Within r of the axis, a quadratic in t for the part of w normal to u
+    double v0[3], ve[3];
+    for (int l = 0; l < 3; l++) {
+        v0[l] = w0[l]-wu/L2*u[l];
+        ve[l] = (l == 0 ? 1 : 0)-u[0]/L2*u[l];
+    }
+    double A = ve[0]*ve[0]+ve[1]*ve[1]+ve[2]*ve[2];
+    double B = 2*(v0[0]*ve[0]+v0[1]*ve[1]+v0[2]*ve[2]);
+    double C = v0[0]*v0[0]+v0[1]*v0[1]+v0[2]*v0[2]-r*r;
+    if (A < 1e-12) {
+        if (C > 0)
+            return false;
+    }
+    else {
+        double disc = B*B-4*A*C;
+        if (disc < 0)
+            return false;
+        disc = sqrt(disc);
+        lo = qMax(lo, (-B-disc)/(2*A));
+        hi = qMin(hi, (-B+disc)/(2*A));
+    }
+
+    if (lo > hi)
+        return false;
+    *x0 = lo;
+    *x1 = hi;
+    return true;
+}
+
+Voxeliser::Voxeliser(EGSPhant *p, int s) {
+    phant = p;
+    samples = s < 1 ? 1 : s;
+}
+
+void Voxeliser::addPrimitive(Primitive &p) {
+    if (p.shape == Primitive::Mesh) {
+        for (int l = 0; l < 3; l++) {
+            p.lo[l] = 1e30;
+            p.hi[l] = -1e30;
+        }
+        for (int n = 0; n < p.triangles.size(); n++) {
+            p.lo[n%3] = qMin(p.lo[n%3], p.triangles[n]);
+            p.hi[n%3] = qMax(p.hi[n%3], p.triangles[n]);
+        }
+    }
+    else
+        for (int l = 0; l < 3; l++) {
+            double e0 = p.a[l], e1 = p.shape == Primitive::Sphere ? p.a[l] : p.b[l];
+            p.lo[l] = qMin(e0, e1)-p.radius;
+            p.hi[l] = qMax(e0, e1)+p.radius;
+        }
+    prims << p;
+}
+
+void Voxeliser::addSphere(const double *c, double r, char medium, double density) {
+    Primitive p;
+    p.shape = Primitive::Sphere;
+    for (int l = 0; l < 3; l++)
+        p.a[l] = p.b[l] = c[l];
+    p.radius = r;
+    p.medium = medium;
+    p.density = density;
+    addPrimitive(p);
+}
+
+void Voxeliser::addCylinder(const double *a, const double *b, double r, char medium, double density) {
+    Primitive p;
+    p.shape = Primitive::Cylinder;
+    for (int l = 0; l < 3; l++) {
+        p.a[l] = a[l];
+        p.b[l] = b[l];
+    }
+    p.radius = r;
+    p.medium = medium;
+    p.density = density;
+    addPrimitive(p);
+}
+
+void Voxeliser::addCapsule(const double *a, const double *b, double r, char medium, double density) {
+    addCylinder(a, b, r, medium, density);
+    prims.last().shape = Primitive::Capsule;
+}
+
+void Voxeliser::addMesh(const QVector <double> &triangles, char medium, double density) {
+    Primitive p;
+    p.shape = Primitive::Mesh;
+    p.triangles = triangles;
+    p.radius = 0;
+    p.medium = medium;
+    p.density = density;
+    addPrimitive(p);
+}
+
+char Voxeliser::mediumCode(QString name) {
+    int n = phant->media.indexOf(name);
+    if (n < 0) {
+        n = phant->media.size();
+        phant->media << name;
+    }
+    return 49 + n + (n>8?7:0) + (n>34?6:0);
+}
+
+int Voxeliser::loadFile(QString path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        std::cout << "Could not open " << path.toStdString() << " for reading, quitting...\n";
+        return 0;
+    }
+
+    QTextStream input(&file);
+    QString line;
+    QStringList parts;
+    double a[3], b[3];
+    int count = 0;
+    while (!input.atEnd()) {
+        line = input.readLine();
+        count++;
+        if (line.contains('#'))
+            line = line.left(line.indexOf('#'));
+        parts = line.simplified().split(' ', QString::SkipEmptyParts);
+        if (parts.isEmpty())
+            continue;
+
+        QString shape = parts[0].toLower();
+        int numbers = shape == "sphere" ? 4 : (shape == "cylinder" || shape == "capsule" ? 7 : -1);
+        if ((numbers > 0 && parts.size() != numbers+3) || (shape == "mesh" && parts.size() != 4 && parts.size() != 5) ||
+            (numbers < 0 && shape != "mesh")) {
+            std::cout << "Line " << count << " of " << path.toStdString() << " is not a sphere, cylinder, capsule or mesh, quitting...\n";
+            return 0;
+        }
+        char medium = mediumCode(parts[1]);
+        double density = parts[2].toDouble();
+
+        if (shape == "mesh") {
+            QVector <double> triangles;
+            if (!loadSTL(parts[3], parts.size() == 5 ? parts[4].toDouble() : 1, &triangles))
+                return 0;
+            addMesh(triangles, medium, density);
+            continue;
+        }
+
+        for (int l = 0; l < 3; l++) {
+            a[l] = parts[3+l].toDouble();
+            b[l] = numbers == 7 ? parts[6+l].toDouble() : a[l];
+        }
+        double r = parts.last().toDouble();
+        if (shape == "sphere")
+            addSphere(a, r, medium, density);
+        else if (shape == "cylinder")
+            addCylinder(a, b, r, medium, density);
+        else
+            addCapsule(a, b, r, medium, density);
+    }
+    file.close();
+    return 1;
+}
+
+int Voxeliser::loadSTL(QString path, double scale, QVector <double> *triangles) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        std::cout << "Could not open " << path.toStdString() << " for reading, quitting...\n";
+        return 0;
+    }
+    QByteArray bytes = file.readAll();
+    file.close();
+    triangles->clear();
+
+    // Binary files are an 80 byte header, a count, then 50 bytes a triangle
+    if (bytes.size() >= 84) {
+        quint32 n = qFromLittleEndian<quint32>((const uchar*)bytes.constData()+80);
+        if (bytes.size() == 84+qint64(n)*50) {
+            triangles->resize(n*9);
+            float v;
+            for (quint32 t = 0; t < n; t++)
+                for (int c = 0; c < 9; c++) {
+                    quint32 bits = qFromLittleEndian<quint32>((const uchar*)bytes.constData()+84+t*50+12+c*4);
+                    memcpy(&v, &bits, 4);
+                    (*triangles)[t*9+c] = v*scale;
+                }
+            return 1;
+        }
+    }
+
+    // Otherwise every vertex line of an ASCII file gives a point
+    QTextStream input(bytes);
+    QString word;
+    double v;
+    while (!input.atEnd()) {
+        input >> word;
+        if (word == "vertex")
+            for (int c = 0; c < 3; c++) {
+                input >> v;
+                triangles->append(v*scale);
+            }
+    }
+    if (triangles->isEmpty() || triangles->size()%9) {
+        std::cout << path.toStdString() << " is not a complete STL file, quitting...\n";
+        return 0;
+    }
+    return 1;
+}
+
+bool Voxeliser::span(const Primitive &p, double y, double z, double *x0, double *x1) const {
+    if (p.shape == Primitive::Sphere)
+        return sphereSpan(p.a, p.radius, y, z, x0, x1);
+    if (p.shape == Primitive::Cylinder)
+        return cylinderSpan(p.a, p.b, p.radius, y, z, x0, x1);
+
+    // A capsule is convex, so its span is the outer ends of those of its parts
+    double s0, s1;
+    bool hit = cylinderSpan(p.a, p.b, p.radius, y, z, x0, x1);
+    const double *ends[2] = {p.a, p.b};
+    for (int e = 0; e < 2; e++)
+        if (sphereSpan(ends[e], p.radius, y, z, &s0, &s1)) {
+            *x0 = hit ? qMin(*x0, s0) : s0;
+            *x1 = hit ? qMax(*x1, s1) : s1;
+            hit = true;
+        }
+    return hit;
+}
+
+void Voxeliser::crossings(const Primitive &p, const QVector <int> &tris, double y, double z, QVector <double> *xs) const {
+    xs->clear();
+    const double *P[3];
+    double w[3], area;
+    for (int n = 0; n < tris.size(); n++) {
+        for (int c = 0; c < 3; c++)
+            P[c] = p.triangles.constData()+tris[n]*9+c*3;
+
+        // Work with the triangle anticlockwise in the y-z plane
+        area = (P[1][1]-P[0][1])*(P[2][2]-P[0][2])-(P[1][2]-P[0][2])*(P[2][1]-P[0][1]);
+        if (area == 0)
+            continue;
+        if (area < 0) {
+            qSwap(P[1], P[2]);
+            area = -area;
+        }
+
+        // The line goes through the triangle if it is inside all three edges,
+        // points on an edge only count for one of the two triangles sharing it
+        bool inside = true;
+        for (int e = 0; e < 3 && inside; e++) {
+            const double *A = P[(e+1)%3], *B = P[(e+2)%3];
+            double dy = B[1]-A[1], dz = B[2]-A[2];
+            w[e] = dy*(z-A[2])-dz*(y-A[1]);
+            inside = w[e] > 0 || (w[e] == 0 && (dz > 0 || (dz == 0 && dy < 0)));
+        }
+        if (inside)
+            *xs << (w[0]*P[0][0]+w[1]*P[1][0]+w[2]*P[2][0])/area;
+    }
+    std::sort(xs->begin(), xs->end());
+}
+
+void Voxeliser::voxeliseSlice(VoxeliseJob &job) {
+    int k = job.k, nx = phant->nx;
+    double z0 = phant->z[k], dz = phant->z[k+1]-z0, weight = 1.0/(samples*samples);
+    const QVector <double> &bx = phant->x;
+    QVector <double> cover(nx, 0), xs;
+    QVector <bool> touched;
+    QVector <int> sliceTris, rowTris;
+    double y0, dy, y, z, x0, x1, f;
+    job.changed = 0;
+
+    for (int n = 0; n < prims.size(); n++) {
+        const Primitive &p = prims[n];
+        if (k < first[n*3+2] || k > last[n*3+2])
+            continue;
+        int i0 = first[n*3], i1 = last[n*3];
+        if (touched.isEmpty())
+            touched.fill(false, nx*phant->ny);
+
+        // Only mesh triangles reaching into this slice can be crossed
+        if (p.shape == Primitive::Mesh) {
+            sliceTris.clear();
+            for (int t = 0; t < p.triangles.size()/9; t++) {
+                const double *T = p.triangles.constData()+t*9;
+                if (qMax(T[2], qMax(T[5], T[8])) >= z0 && qMin(T[2], qMin(T[5], T[8])) <= z0+dz)
+                    sliceTris << t;
+            }
+        }
+
+        for (int j = first[n*3+1]; j <= last[n*3+1]; j++) {
+            y0 = phant->y[j];
+            dy = phant->y[j+1]-y0;
+            for (int i = i0; i <= i1; i++)
+                cover[i] = 0;
+
+            if (p.shape == Primitive::Mesh) {
+                rowTris.clear();
+                for (int t = 0; t < sliceTris.size(); t++) {
+                    const double *T = p.triangles.constData()+sliceTris[t]*9;
+                    if (qMax(T[1], qMax(T[4], T[7])) >= y0 && qMin(T[1], qMin(T[4], T[7])) <= y0+dy)
+                        rowTris << sliceTris[t];
+                }
+                if (rowTris.isEmpty())
+                    continue;
+            }
+
+            // Add up how much of each voxel every sample line spends inside
+            for (int qy = 0; qy < samples; qy++)
+                for (int qz = 0; qz < samples; qz++) {
+                    y = y0+(qy+0.5)*dy/samples;
+                    z = z0+(qz+0.5)*dz/samples;
+                    xs.clear();
+                    if (p.shape == Primitive::Mesh)
+                        crossings(p, rowTris, y, z, &xs);
+                    else if (span(p, y, z, &x0, &x1))
+                        xs << x0 << x1;
+
+                    for (int e = 0; e+1 < xs.size(); e += 2)
+                        for (int i = i0; i <= i1; i++) {
+                            f = qMin(xs[e+1], bx[i+1])-qMax(xs[e], bx[i]);
+                            if (f > 0)
+                                cover[i] += f/(bx[i+1]-bx[i]);
+                        }
+                }
+
+            for (int i = i0; i <= i1; i++) {
+                f = qMin(cover[i]*weight, 1.0);
+                if (f <= 0)
+                    continue;
+                phant->d(i,j,k) = phant->d(i,j,k)*(1-f)+p.density*f;
+                if (f >= 0.5)
+                    phant->m(i,j,k) = p.medium;
+                if (!touched[j*nx+i]) {
+                    touched[j*nx+i] = true;
+                    job.changed++;
+                }
+            }
+        }
+    }
+}
+
+unsigned long int Voxeliser::apply() {
+    // Cull each primitive to the voxels of its bounding box
+    first.resize(prims.size()*3);
+    last.resize(prims.size()*3);
+    QVector <bool> used(phant->nz, false);
+    const QVector <double> *b[3] = {&phant->x, &phant->y, &phant->z};
+    for (int n = 0; n < prims.size(); n++) {
+        for (int l = 0; l < 3; l++)
+            voxelRange(*b[l], prims[n].lo[l], prims[n].hi[l], &first[n*3+l], &last[n*3+l]);
+        for (int k = first[n*3+2]; k <= last[n*3+2] && first[n*3] <= last[n*3] && first[n*3+1] <= last[n*3+1]; k++)
+            used[k] = true;
+        if (prims[n].density > phant->maxDensity)
+            phant->maxDensity = prims[n].density;
+    }
+
+    // Slices are independent, each goes through the primitives in order
+    QVector <VoxeliseJob> jobs;
+    for (int k = 0; k < phant->nz; k++)
+        if (used[k]) {
+            VoxeliseJob job;
+            job.voxeliser = this;
+            job.k = k;
+            job.changed = 0;
+            jobs << job;
+        }
+    QtConcurrent::blockingMap(jobs, voxeliseSliceJob);
+
+    unsigned long int changed = 0;
+    for (int n = 0; n < jobs.size(); n++)
+        changed += jobs[n].changed;
+    return changed;
+}
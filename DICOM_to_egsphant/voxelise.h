@@ -0,0 +1,92 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef VOXELISE_H
+#define VOXELISE_H
+
+#include <QtConcurrent>
+#include "egsphant.h"
+
+// A solid to be written into an egsphant, all in egsphant coordinates (cm)
+struct Primitive {
+    enum Shape {Sphere, Cylinder, Capsule, Mesh};
+    Shape shape;
+    double a[3], b[3], radius; // the center of spheres, or the ends of the axis of cylinders and capsules
+    QVector <double> triangles; // nine coordinates per triangle of (closed) meshes
+    char medium;
+    double density;
+    double lo[3], hi[3]; // the bounding box
+};
+
+class Voxeliser;
+
+// One z slice of voxels to write every primitive into
+struct VoxeliseJob {
+    Voxeliser *voxeliser;
+    int k;
+    unsigned long int changed; // voxels any primitive covered part of
+};
+
+// Writes spheres, cylinders, capsules and closed triangle meshes (seeds,
+// applicators, catheters) into an egsphant with partial volume coverage,
+// found exactly along x over samples by samples lines through each voxel in
+// y and z, a voxel takes the medium of a primitive covering at least half of
+// it and the covered fraction of its density, later primitives going over
+// earlier ones
+class Voxeliser {
+public:
+    Voxeliser(EGSPhant *p, int s = 4);
+
+    int samples; // sample lines along y and along z through each voxel
+
+    void addSphere(const double *c, double r, char medium, double density);
+    void addCylinder(const double *a, const double *b, double r, char medium, double density);
+    void addCapsule(const double *a, const double *b, double r, char medium, double density);
+    void addMesh(const QVector <double> &triangles, char medium, double density);
+    int size() const {return prims.size();}
+
+    // Read a list of primitives, one per line as
+    //   sphere MEDIUM DENSITY x y z r
+    //   cylinder MEDIUM DENSITY x0 y0 z0 x1 y1 z1 r
+    //   capsule MEDIUM DENSITY x0 y0 z0 x1 y1 z1 r
+    //   mesh MEDIUM DENSITY file.stl [scale]
+    // with # starting comments, media not yet in the egsphant are added to it
+    int loadFile(QString path);
+
+    // Read the triangles of an ASCII or binary STL file, scaled by scale
+    static int loadSTL(QString path, double scale, QVector <double> *triangles);
+
+    // Write every primitive into the egsphant, slices in parallel, returns
+    // the number of voxels changed
+    unsigned long int apply();
+
+    void voxeliseSlice(VoxeliseJob &job);
+
+private:
+    EGSPhant *phant;
+    QVector <Primitive> prims;
+    QVector <int> first, last; // the voxels in the box of each primitive, three each
+
+    void addPrimitive(Primitive &p);
+    char mediumCode(QString name);
+
+    // The span [*x0,*x1] of the line along x through y and z inside a convex
+    // primitive, false if it misses
+    bool span(const Primitive &p, double y, double z, double *x0, double *x1) const;
+
+    // Where the line along x through y and z crosses a mesh, sorted
+    void crossings(const Primitive &p, const QVector <int> &tris, double y, double z, QVector <double> *xs) const;
+};
+
+#endif
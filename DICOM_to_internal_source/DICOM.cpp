@@ -18,14 +18,27 @@ Attribute::~Attribute() {
 SequenceItem::SequenceItem(unsigned long int size, unsigned char *data) {
     vl = size;
     vf = data;
+    offset = 0;
+    owned = true;
+}
+
+SequenceItem::SequenceItem(unsigned long int size, unsigned long int off, Sequence *parent) {
+    vl = size;
+    vf = (unsigned char*)(parent->raw.constData()) + off; // No copy, just a view into the sequence
+    offset = off;
+    owned = false;
 }
 
 SequenceItem::~SequenceItem() {
-    if (vf != NULL) {
+    if (vf != NULL && owned) {
 		delete[] vf;
     }
 }
 
+Sequence::Sequence() {
+    implicit = false;
+}
+
 Sequence::~Sequence() {
     for (int i = 0; i < items.size(); i++) {
         delete items[i];
@@ -45,223 +58,399 @@ DICOM::~DICOM() {
     data.clear();
 }
 
-int DICOM::readSequence(QDataStream *in, Attribute *att) {
-    bool flag = true;
-	int depth = 0;
-    unsigned int *tag, size;
-    unsigned char *dat;
-    while (flag) {
-        tag = new unsigned int;
-        if (in->readRawData((char*)tag, 4) != 4) {
-            // Not a DICOM file
-            delete tag;
-            return 0;
-        }
-        if (in->readRawData((char*)(&size), 4) != 4) {
-            // Not a DICOM file
-            delete tag;
-            return 0;
-        }
+// Little endian helpers for walking raw element headers
+static inline unsigned short int readLE16(const unsigned char *p) {
+	return ((unsigned short int)(p[1]) << 8) + (unsigned short int)p[0];
+}
 
-        if (*tag == (unsigned int)0xE0DDFFFE) { // sequence delimiter
-            flag = false;
-        }
-        else if (size != (unsigned int)0xFFFFFFFF) {
-            // sequence item with defined size
-            dat = new unsigned char[size];
-            if ((unsigned int)in->readRawData((char*)dat, size) != size) {
-                // Not a DICOM file
-                delete tag;
-                delete[] dat;
-                return 0;
-            }
-            att->seq.items.append(new SequenceItem(size, dat));
-        }
-        else if (size == (unsigned int)0xFFFFFFFF) {
-            // sequence item with undefined size
-            QByteArray buffer;
-			depth = 0;
-            dat = new unsigned char[1];
-            while (true) { // Keeping appending data one char at a time...
-                if (in->readRawData((char*)dat, 1) != 1) {
-                    // Not a DICOM file
-                    delete tag;
-                    delete[] dat;
-                    return 0;
-                }
-                buffer.append(*dat);
-				
-				// Is there a subsequence we are parsing
-				if (buffer.endsWith("")) {
-					if (!isImplicit) {
-						if (buffer.endsWith("SQ\0\0")) {
-							depth++; // Increase depth to skip delimiters until we exit subsequence	
-						}
-					}
-					else {
-						unsigned short int tag[2];
-						tag[0] = *(unsigned short int*)(buffer.right(8).left(2).data());
-						tag[1] = *(unsigned short int*)(buffer.right(6).left(2).data());
-						Reference nearest = lib->binSearch(tag[0], tag[1], 0, lib->lib.size()-1);
-						if (nearest.tag[0] == tag[0] && nearest.tag[1] == tag[1] && !nearest.vr.compare("SQ")) {
-							depth++; // Increase depth to skip delimiters until we exit subsequence								
-						}
-					}
-				}
-				
-                // ...until we reach the sequence item delimiter
-                if (*((unsigned int*)buffer.right(4).data()) == (unsigned int)0xE00DFFFE && !depth) {
-					buffer.chop(4);
-                    delete[] dat;
-                    dat = new unsigned char[4];
-                    if (in->readRawData((char*)dat, 4) != 4) {
-                        // Not a DICOM file
-                        delete tag;
-                        delete[] dat;
-                        return 0;
-                    }
-                    delete[] dat;
-                    dat = new unsigned char[buffer.size()];
-                    for (int i = 0; i < buffer.size(); i++) {
-                        dat[i] = buffer[i];
-                    }
-                    att->seq.items.append(new SequenceItem(buffer.size(),dat));
-                    break;
-                }
-				else if (*((unsigned int*)buffer.right(4).data()) == (unsigned int)0xE0DDFFFE) {
-					depth--;
-				}
-            }
-        }
+static inline unsigned int readLE32(const unsigned char *p) {
+	return ((unsigned int)(p[3]) << 24) + ((unsigned int)(p[2]) << 16) +
+		   ((unsigned int)(p[1]) << 8) + (unsigned int)p[0];
+}
 
-        delete tag;
-    }
-    return 1;
+// Get at the memory behind in, if it is reading from memory at all
+static int streamBuffer(QDataStream *in, const unsigned char **buf, unsigned long int *n) {
+	QBuffer *device = qobject_cast<QBuffer*>(in->device());
+	if (device == NULL)
+		return 0;
+	*buf = (const unsigned char*)(device->data().constData()) + device->pos();
+	*n = device->size() - device->pos();
+	return 1;
 }
 
-int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n) {
-	int depth = 0;
-    unsigned int *tag, size;
-    unsigned char *dat;
-    while (n > 0) {
-        tag = new unsigned int;
-        if (in->readRawData((char*)tag, 4) != 4) {
-            // Not a DICOM file
-            delete tag;
-            return 0;
-        }
-        if (in->readRawData((char*)(&size), 4) != 4) {
-            // Not a DICOM file
-            delete tag;
-            return 0;
-        }
-		n-=8;
+// Explicit VRs with a 4 byte length, the same ones as in lib->implicitVR
+static inline bool isLongVR(const unsigned char *VR) {
+	return (VR[0] == 'O' && (VR[1] == 'B' || VR[1] == 'W' || VR[1] == 'F')) ||
+		   (VR[0] == 'S' && VR[1] == 'Q') ||
+		   (VR[0] == 'U' && (VR[1] == 'T' || VR[1] == 'N'));
+}
 
-        if (size != (unsigned int)0xFFFFFFFF) {
-            // sequence item with defined size
-            dat = new unsigned char[size];
-            if ((unsigned int)in->readRawData((char*)dat, size) != size) {
-                // Not a DICOM file
-                delete tag;
-                delete[] dat;
-                return 0;
-            }
-            att->seq.items.append(new SequenceItem(size, dat));
-			n-=size;
-        }
-        else if (size == (unsigned int)0xFFFFFFFF) {
-            // sequence item with undefined size
-            QByteArray buffer;
-            dat = new unsigned char[1];
-            while (true) { // Keeping appending data one char at a time...
-                if (in->readRawData((char*)dat, 1) != 1) {
-                    // Not a DICOM file
-                    delete tag;
-                    delete[] dat;
-                    return 0;
-                }
-                buffer.append(*dat);
-				
-				// Is there a subsequence we are parsing
-				if (buffer.endsWith("")) {
-					if (!isImplicit) {
-						if (buffer.endsWith("SQ\0\0")) {
-							depth++; // Increase depth to skip delimiters until we exit subsequence	
-						}
-					}
-					else {
-						unsigned short int tag[2];
-						tag[0] = *(unsigned short int*)(buffer.right(8).left(2).data());
-						tag[1] = *(unsigned short int*)(buffer.right(6).left(2).data());
-						Reference nearest = lib->binSearch(tag[0], tag[1], 0, lib->lib.size()-1);
-						if (nearest.tag[0] == tag[0] && nearest.tag[1] == tag[1] && !nearest.vr.compare("SQ")) {
-							depth++; // Increase depth to skip delimiters until we exit subsequence								
-						}
-					}
-				}
-				
-                // ...until we reach the sequence item delimiter
-                if (*((unsigned int*)buffer.right(4).data()) == (unsigned int)0xE00DFFFE && !depth) {
-                    delete[] dat;
-                    dat = new unsigned char[4];
-                    if (in->readRawData((char*)dat, 4) != 4) {
-                        // Not a DICOM file
-                        delete tag;
-                        delete[] dat;
-                        return 0;
-                    }
-                    delete[] dat;
-                    dat = new unsigned char[buffer.size()];
-                    for (int i = 0; i < buffer.size(); i++) {
-                        dat[i] = buffer[i];
-                    }
-                    att->seq.items.append(new SequenceItem(buffer.size(),dat));
-					n-=buffer.size();
-                    break;
-                }
-				else if (*((unsigned int*)buffer.right(4).data()) == (unsigned int)0xE0DDFFFE)
-					depth--;
-            }
-        }
+// Returns the size of the header of the data element at the start of buf (8 or
+// 12 bytes) and puts its value length in length, or 0 if it runs past n bytes
+unsigned long int DICOM::elementHeader(const unsigned char *buf, unsigned long int n, unsigned long int *length) {
+	return elementHeader(buf, n, length, isImplicit);
+}
 
-        delete tag;
-    }
-    return 1;
+// As above, but with the VR encoding given by implicit rather than the transfer
+// syntax, as the inside of an undefined length UN value is always implicit
+unsigned long int DICOM::elementHeader(const unsigned char *buf, unsigned long int n, unsigned long int *length, bool implicit) {
+	if (n < 8)
+		return 0;
+	
+	// Items and delimiters are always implicit, as is everything outside group
+	// 0002 in an implicit transfer syntax
+	unsigned short int group = readLE16(buf);
+	if (group == 0xFFFE || (implicit && group != 0x0002)) {
+		*length = readLE32(buf+4);
+		return 8;
+	}
+	else if (isLongVR(buf+4)) {
+		if (n < 12)
+			return 0;
+		*length = readLE32(buf+8);
+		return 12;
+	}
+	*length = readLE16(buf+6);
+	return 8;
+}
+
+// Returns the number of bytes taken by the whole data element (header and
+// value) at the start of buf, walking through undefined length values without
+// decoding anything, or 0 if it runs past n bytes
+unsigned long int DICOM::elementSize(const unsigned char *buf, unsigned long int n) {
+	return elementSize(buf, n, isImplicit);
+}
+
+unsigned long int DICOM::elementSize(const unsigned char *buf, unsigned long int n, bool implicit) {
+	unsigned long int length, head = elementHeader(buf, n, &length, implicit);
+	if (!head)
+		return 0;
+	
+	unsigned short int group = readLE16(buf), element = readLE16(buf+2);
+	if (length != (unsigned long int)0xFFFFFFFF)
+		return head+length <= n ? head+length : 0;
+	
+	// Undefined length, an item ends on an item delimiter and anything else
+	// (sequences or encapsulated pixel data) on a sequence delimiter
+	unsigned short int delimiter = (group == 0xFFFE && element == 0xE000) ? 0xE00D : 0xE0DD;
+	unsigned long int pos = head, size;
+	
+	// An explicit UN of undefined length holds implicit VR elements (PS3.5 6.2.2)
+	if (head == 12 && buf[4] == 'U' && buf[5] == 'N')
+		implicit = true;
+	
+	while (pos+8 <= n) {
+		if (readLE16(buf+pos) == 0xFFFE && readLE16(buf+pos+2) == delimiter)
+			return pos+8;
+		
+		size = elementSize(buf+pos, n-pos, implicit);
+		if (!size)
+			return 0;
+		pos += size;
+	}
+	return 0;
+}
+
+// Forward only version of elementSize for streams that cannot be walked in
+// memory, head holds the first 8 bytes of the element which were already read
+// from in, and the whole element gets appended to raw (or skipped if raw is NULL)
+int DICOM::copyElement(QDataStream *in, const unsigned char *head, QByteArray *raw) {
+	return copyElement(in, head, raw, isImplicit);
+}
+
+int DICOM::copyElement(QDataStream *in, const unsigned char *head, QByteArray *raw, bool implicit) {
+	unsigned short int group = readLE16(head), element = readLE16(head+2);
+	unsigned long int length;
+	unsigned char dat[8];
+	if (raw != NULL)
+		raw->append((const char*)head, 8);
+	
+	if (group == 0xFFFE || (implicit && group != 0x0002)) {
+		length = readLE32(head+4);
+	}
+	else if (isLongVR(head+4)) {
+		if (in->readRawData((char*)dat, 4) != 4)
+			return 0;
+		if (raw != NULL)
+			raw->append((const char*)dat, 4);
+		length = readLE32(dat);
+		
+		// An explicit UN of undefined length holds implicit VR elements (PS3.5 6.2.2)
+		if (head[4] == 'U' && head[5] == 'N')
+			implicit = true;
+	}
+	else {
+		length = readLE16(head+6);
+	}
+	
+	if (length != (unsigned long int)0xFFFFFFFF && raw == NULL) {
+		return in->skipRawData(length) == (int)length;
+	}
+	else if (length != (unsigned long int)0xFFFFFFFF) {
+		int start = raw->size();
+		raw->resize(start+length);
+		return in->readRawData(raw->data()+start, length) == (int)length;
+	}
+	
+	// Undefined length, keep copying elements until the matching delimiter
+	unsigned short int delimiter = (group == 0xFFFE && element == 0xE000) ? 0xE00D : 0xE0DD;
+	while (in->readRawData((char*)dat, 8) == 8) {
+		if (readLE16(dat) == 0xFFFE && readLE16(dat+2) == delimiter) {
+			if (raw != NULL)
+				raw->append((const char*)dat, 8);
+			return 1;
+		}
+		
+		if (!copyElement(in, dat, raw, implicit))
+			return 0;
+	}
+	return 0;
+}
+
+// Whether elements of group are dropped while parsing, the meta information
+// group is always needed for the transfer syntax
+bool DICOM::isSkipped(unsigned short int group) {
+	if (group == 0x0002 || group == 0xFFFE)
+		return false;
+	if (skipPrivate && group%2)
+		return true;
+	if (skipOverlays && (group & 0xFF00) == 0x6000)
+		return true;
+	return skipGroups.contains(group);
+}
+
+// Skip the element whose first 8 bytes are in head without keeping any of it,
+// if it is the group length then the rest of the group is skipped in one go
+int DICOM::skipElement(QDataStream *in, const unsigned char *head) {
+	if (readLE16(head+2) == 0x0000) {
+		// Group length is a UL, so a 4 byte value for explicit and implicit VR
+		unsigned char dat[4];
+		if (in->readRawData((char*)dat, 4) != 4)
+			return 0;
+		unsigned long int n = readLE32(dat);
+		return in->skipRawData(n) == (int)n;
+	}
+	
+	// No group length, skip just this element
+	return copyElement(in, head, NULL);
+}
+
+// Record where every item of seq lies within seq->raw, no items are decoded
+int DICOM::indexSequence(Sequence *seq) {
+	const unsigned char *buf = (const unsigned char*)(seq->raw.constData());
+	unsigned long int n = seq->raw.size(), pos = 0, size, length;
+	
+	while (pos+8 <= n) {
+		if (readLE16(buf+pos) != 0xFFFE || readLE16(buf+pos+2) != 0xE000) {
+			// Not a sequence item
+			return 0;
+		}
+		
+		length = readLE32(buf+pos+4);
+		if (length != (unsigned long int)0xFFFFFFFF) {
+			// sequence item with defined size
+			if (pos+8+length > n)
+				return 0;
+			seq->items.append(new SequenceItem(length, pos+8, seq));
+			pos += 8+length;
+		}
+		else {
+			// sequence item with undefined size, drop the header and delimiter
+			size = elementSize(buf+pos, n-pos, seq->implicit);
+			if (!size)
+				return 0;
+			seq->items.append(new SequenceItem(size-16, pos+8, seq));
+			pos += size;
+		}
+	}
+	return 1;
+}
+
+int DICOM::readSequence(QDataStream *in, Attribute *att, bool implicit) {
+	const unsigned char *buf;
+	unsigned long int n, pos = 0, size;
+	att->seq.implicit = implicit;
+	if (!streamBuffer(in, &buf, &n)) {
+		// Not in memory, so copy items as they come until the sequence delimiter
+		unsigned char head[8];
+		while (in->readRawData((char*)head, 8) == 8) {
+			if (readLE16(head) == 0xFFFE && readLE16(head+2) == 0xE0DD)
+				return indexSequence(&att->seq);
+			
+			if (!copyElement(in, head, &(att->seq.raw), implicit)) {
+				// Not a DICOM file
+				return 0;
+			}
+		}
+		// Not a DICOM file
+		return 0;
+	}
+	
+	// Find the sequence delimiter by stepping over whole items
+	while (pos+8 <= n && !(readLE16(buf+pos) == 0xFFFE && readLE16(buf+pos+2) == 0xE0DD)) {
+		size = elementSize(buf+pos, n-pos, implicit);
+		if (!size) {
+			// Not a DICOM file
+			return 0;
+		}
+		pos += size;
+	}
+	if (pos+8 > n) {
+		// Not a DICOM file
+		return 0;
+	}
+	
+	// Keep all the items in one block and move past the delimiter
+	att->seq.raw = QByteArray((const char*)buf, pos);
+	if (!indexSequence(&att->seq))
+		return 0;
+	
+	return in->skipRawData(pos+8) == (int)(pos+8);
+}
+
+int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n, bool implicit) {
+	const unsigned char *buf;
+	unsigned long int size;
+	att->seq.implicit = implicit;
+	if (!streamBuffer(in, &buf, &size)) {
+		// Not in memory, so read the items in one go
+		att->seq.raw.resize(n);
+		if ((unsigned long int)in->readRawData(att->seq.raw.data(), n) != n) {
+			// Not a DICOM file
+			return 0;
+		}
+		return indexSequence(&att->seq);
+	}
+	if (n > size) {
+		// Not a DICOM file
+		return 0;
+	}
+	
+	// Keep all the items in one block
+	att->seq.raw = QByteArray((const char*)buf, n);
+	if (!indexSequence(&att->seq))
+		return 0;
+	
+	return in->skipRawData(n) == (int)n;
+}
+
+// Decode item i of seq into att, sequences are only indexed by parse so this
+// only does the work for the items that are actually used
+int DICOM::parseItem(Sequence *seq, int i, QVector <Attribute*> *att) {
+	if (i < 0 || i >= seq->items.size())
+		return 0;
+	
+	QByteArray item = QByteArray::fromRawData((const char*)(seq->items[i]->vf), seq->items[i]->vl);
+	QBuffer buffer(&item);
+	buffer.open(QIODevice::ReadOnly);
+	QDataStream in(&buffer);
+	return parseSequence(&in, att, seq->implicit);
 }
 	
 int DICOM::parse(QString p) {
 	path = p;
     QFile file(path);
-    int k = 0, l = 0;
     if (file.open(QIODevice::ReadOnly)) {
+		int l = parse(&file);
+		file.close();
+		return l;
+    }
+    return 0;
+}
+
+// Parse an object that is already in memory, buf is read in place (no copy is
+// made) and only needs to live until this returns
+int DICOM::parse(const unsigned char *buf, unsigned long int n) {
+	if (n > (unsigned long int)INT_MAX) {
+		std::cout << "DICOM object is too large to parse from memory, quitting...\n";
+		return 0;
+	}
+	
+	QByteArray bytes = QByteArray::fromRawData((const char*)buf, n);
+	QBuffer buffer(&bytes);
+	buffer.open(QIODevice::ReadOnly);
+	QDataStream in(&buffer);
+	return parseStream(&in);
+}
+
+// Parse from an open device, files are mapped and buffers are read in place,
+// while pipes, sockets and stdin are read until they close and parsed from
+// memory, anything too large for one QByteArray goes through the chunked
+// stream reader instead
+int DICOM::parse(QIODevice *device) {
+	if (device->isSequential()) {
+		// A process or socket may not have sent everything yet, so wait for
+		// more until it closes (read blocks on its own for stdin and pipes)
+		QByteArray bytes, chunk;
+		while (true) {
+			chunk = device->read(1 << 20);
+			if (!chunk.isEmpty()) {
+				if ((qint64)bytes.size()+chunk.size() > (qint64)INT_MAX) {
+					std::cout << "DICOM object is too large to parse from a stream, quitting...\n";
+					return 0;
+				}
+				bytes += chunk;
+			}
+			else if (!device->waitForReadyRead(-1) && !device->bytesAvailable()) {
+				break;
+			}
+		}
+		return parse((const unsigned char*)(bytes.constData()), bytes.size());
+	}
+	
+	QBuffer *buffer = qobject_cast<QBuffer*>(device);
+	if (buffer != NULL)
+		return parse((const unsigned char*)(buffer->data().constData()) + buffer->pos(),
+					 buffer->size() - buffer->pos());
+	
+	if (device->size() - device->pos() > (qint64)INT_MAX) {
+		QDataStream in(device);
+		return parseStream(&in);
+	}
+	
+	QFile *file = qobject_cast<QFile*>(device);
+	if (file != NULL) {
+		unsigned char *map = file->map(file->pos(), file->size() - file->pos());
+		if (map != NULL) {
+			int l = parse(map, file->size() - file->pos());
+			file->unmap(map);
+			return l;
+		}
+	}
+	
+	// Could not map it, so read it all at once
+	QByteArray bytes = device->readAll();
+	return parse((const unsigned char*)(bytes.constData()), bytes.size());
+}
+
+// The actual reader, everything above funnels into this
+int DICOM::parseStream(QDataStream *in) {
+    int k = 0, l = 0;
+    if (in->device() != NULL && in->device()->isReadable()) {
         unsigned char *dat;
-        QDataStream in(&file);
-        in.setByteOrder(QDataStream::LittleEndian);
+        in->setByteOrder(QDataStream::LittleEndian);
 
         /*============================================================================*/
         /*DICOM HEADER READER=========================================================*/
         // Skip the first bit of white space in DICOM
         dat = new unsigned char[128];
-        if (in.readRawData((char*)dat, 128) != 128) {
+        if (in->readRawData((char*)dat, 128) != 128) {
             // Not a DICOM file
             delete[] dat;
-            file.close();
             return 0;
         }
         delete[] dat;
 
         // Read in DICM characters at start of file
         dat = new unsigned char[4];
-        if (in.readRawData((char*)dat, 4) != 4) {
+        if (in->readRawData((char*)dat, 4) != 4) {
             // Not a DICOM file
             delete[] dat;
-            file.close();
             return 0;
         }
         else if ((QString(dat[0])+dat[1]+dat[2]+dat[3]) != "DICM") {
             // Not a DICOM file
             delete[] dat;
-            file.close();
             return 0;
         }
         delete[] dat;
@@ -272,7 +461,7 @@ int DICOM::parse(QString p) {
         unsigned int size;
         QString VR;
         bool nested = false;
-        while (!in.atEnd()) {
+        while (!in->atEnd()) {
             temp = new Attribute();
 
             /*============================================================================*/
@@ -283,10 +472,9 @@ int DICOM::parse(QString p) {
                 std::cout << std::dec << k << ") " << "Tag "; 
             #endif
             dat = new unsigned char[4];
-            if (in.readRawData((char*)dat,4) != 4) {
+            if (in->readRawData((char*)dat,4) != 4) {
                 // Not a DICOM file
                 delete[] dat;
-                file.close();
                 return 0;
             }
             temp->tag[0]= ((unsigned short int)(dat[1]) << 8) +
@@ -303,9 +491,24 @@ int DICOM::parse(QString p) {
                 // Not a DICOM file
 				std::cout << "Misreading sequence delimiters as top level data elements, something has gone wrong, quitting...\n";
                 delete[] dat;
-                file.close();
                 return 0;
 			}
+			
+			// Groups the caller does not need are skipped rather than read
+			if (isSkipped(temp->tag[0])) {
+				unsigned char head[8] = {(unsigned char)(temp->tag[0] & 0xFF), (unsigned char)(temp->tag[0] >> 8),
+										 (unsigned char)(temp->tag[1] & 0xFF), (unsigned char)(temp->tag[1] >> 8)};
+				if (in->readRawData((char*)(head+4), 4) != 4 || !skipElement(in, head)) {
+					// Not a DICOM file
+					delete temp;
+					return 0;
+				}
+				#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
+					std::cout << "Skipped\n";
+				#endif
+				delete temp;
+				continue;
+			}
 
             /*============================================================================*/
             /*NON-NESTED PROCEDURE: GET VR, SIZE AND DATA=================================*/
@@ -314,10 +517,9 @@ int DICOM::parse(QString p) {
             dat = new unsigned char[4];
 			
             if (!isImplicit || temp->tag[0] == 0x0002) {
-                if (in.readRawData((char*)dat,4) != 4) {
+                if (in->readRawData((char*)dat,4) != 4) {
                     // Not a DICOM file
                     delete[] dat;
-                    file.close();
                     return 0;
                 }
 
@@ -338,10 +540,9 @@ int DICOM::parse(QString p) {
 			
             // Get size
 			if ((temp->tag[0] != 0x0002 && isImplicit) || (lib->implicitVR.contains(VR))) {
-                if (in.readRawData((char*)dat,4) != 4) { //Reread for size
+                if (in->readRawData((char*)dat,4) != 4) { //Reread for size
                     // Not a DICOM file
                     delete[] dat;
-                    file.close();
                     return 0;
                 }
                 temp->vl = ((unsigned int)(dat[3]) << 24) +
@@ -349,26 +550,25 @@ int DICOM::parse(QString p) {
                            ((unsigned int)(dat[1]) << 8) +
                            (unsigned int)dat[0];
 
-                // We have a sequence
-                if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
+                // We have a sequence, an undefined length UN is one in implicit VR
+                if ((!VR.compare("SQ") || !VR.compare("UN")) && temp->vl == (unsigned int)0xFFFFFFFF) {
                     nested = true;
-                    if (!readSequence(&in, temp)) {
+                    if (!readSequence(in, temp, isImplicit || !VR.compare("UN"))) {
                         return 0;
                     }
                 }
 				else if (!VR.compare("SQ")) {
                     nested = true;
-                    if (!readDefinedSequence(&in, temp, temp->vl)) {
+                    if (!readDefinedSequence(in, temp, temp->vl, isImplicit)) {
                         return 0;
                     }
                 }					
 			}
             else {
 				if (isImplicit && temp->tag[0] != 0x0002)
-					if (in.readRawData((char*)dat,4) != 4) {
+					if (in->readRawData((char*)dat,4) != 4) {
 						// Not a DICOM file
 						delete[] dat;
-						file.close();
 						return 0;
 					}
 
@@ -381,16 +581,16 @@ int DICOM::parse(QString p) {
 							   ((unsigned int)(dat[1]) << 8) +
 							   (unsigned int)dat[0];
 							   
-				// We have a sequence
-                if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
+				// We have a sequence, an undefined length UN is one in implicit VR
+                if ((!VR.compare("SQ") || !VR.compare("UN")) && temp->vl == (unsigned int)0xFFFFFFFF) {
                     nested = true;
-                    if (!readSequence(&in, temp)) {
+                    if (!readSequence(in, temp, isImplicit || !VR.compare("UN"))) {
                         return 0;
                     }
                 }
 				else if (!VR.compare("SQ")) {
                     nested = true;
-                    if (!readDefinedSequence(&in, temp, temp->vl)) {
+                    if (!readDefinedSequence(in, temp, temp->vl, isImplicit)) {
                         return 0;
                     }
                 }	
@@ -424,9 +624,8 @@ int DICOM::parse(QString p) {
             if (!nested) {
                 temp->vf = new unsigned char[size];
                 if (size > 0 && size < (unsigned long int)INT_MAX) {
-                    if (in.readRawData((char*)temp->vf,size) != (long int)size) {
+                    if (in->readRawData((char*)temp->vf,size) != (long int)size) {
                         // Not a DICOM file
-                        file.close();
                         return 0;
                     }
                 }
@@ -435,9 +634,8 @@ int DICOM::parse(QString p) {
                     unsigned char *pt = temp->vf;
                     for (int i = 0; (unsigned long int)i <
                             size/((unsigned long int)INT_MAX); i++) {
-                        if (in.readRawData((char*)pt,INT_MAX) != INT_MAX) {
+                        if (in->readRawData((char*)pt,INT_MAX) != INT_MAX) {
                             // Not a DICOM file
-                            file.close();
                             return 0;
                         }
                         pt += sizeof(char)*INT_MAX;
@@ -594,13 +792,12 @@ int DICOM::parse(QString p) {
             /*============================================================================*/
             /*REPEAT UNTIL EOF============================================================*/
         }
-        file.close();
         return l;
     }
     return 0;
 }
 
-int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
+int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att, bool implicit) {
 	unsigned char *dat;
 	in->setByteOrder(QDataStream::LittleEndian);
 	Attribute *temp;
@@ -637,7 +834,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 		
 		// Get the VR
 		dat = new unsigned char[4];		
-		if (!isImplicit || temp->tag[0] == 0x0002) {
+		if (!implicit || temp->tag[0] == 0x0002) {
 			if (in->readRawData((char*)dat,4) != 4) {
 				// Not a DICOM file
 				delete[] dat;
@@ -658,7 +855,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 		}
 		
 		// Get size
-		if ((temp->tag[0] != 0x0002 && isImplicit) || (lib->implicitVR.contains(VR))) {
+		if ((temp->tag[0] != 0x0002 && implicit) || (lib->implicitVR.contains(VR))) {
 			if (in->readRawData((char*)dat,4) != 4) { //Reread for size
 				// Not a DICOM file
 				delete[] dat;
@@ -670,10 +867,10 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 					   ((unsigned int)(dat[1]) << 8) +
 					   (unsigned int)dat[0];
 
-			// We have a sequence
-			if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
+			// We have a sequence, an undefined length UN is one in implicit VR
+			if ((!VR.compare("SQ") || !VR.compare("UN")) && temp->vl == (unsigned int)0xFFFFFFFF) {
 				nested = true;
-				if (!readSequence(in, temp)) {
+				if (!readSequence(in, temp, implicit || !VR.compare("UN"))) {
 					delete[] dat;
 					delete temp;
 					return 0;
@@ -681,7 +878,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			}
 			else if (!VR.compare("SQ")) {
 				nested = true;
-				if (!readDefinedSequence(in, temp, temp->vl)) {
+				if (!readDefinedSequence(in, temp, temp->vl, implicit)) {
 					delete[] dat;
 					delete temp;
 					return 0;
@@ -689,7 +886,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			}
 		}
 		else {
-			if (isImplicit && temp->tag[0] != 0x0002)
+			if (implicit && temp->tag[0] != 0x0002)
 				if (in->readRawData((char*)dat,4) != 4) {
 					// Not a DICOM file
 					delete[] dat;
@@ -706,10 +903,10 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 						   ((unsigned int)(dat[1]) << 8) +
 						   (unsigned int)dat[0];
 						   
-			// We have a sequence
-			if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
+			// We have a sequence, an undefined length UN is one in implicit VR
+			if ((!VR.compare("SQ") || !VR.compare("UN")) && temp->vl == (unsigned int)0xFFFFFFFF) {
 				nested = true;
-				if (!readSequence(in, temp)) {
+				if (!readSequence(in, temp, implicit || !VR.compare("UN"))) {
 					delete[] dat;
 					delete temp;
 					return 0;
@@ -717,7 +914,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			}
 			else if (!VR.compare("SQ")) {
 				nested = true;
-				if (!readDefinedSequence(in, temp, temp->vl)) {
+				if (!readDefinedSequence(in, temp, temp->vl, implicit)) {
 					delete[] dat;
 					delete temp;
 					return 0;
@@ -16,6 +16,9 @@ class Attribute;
 class Sequence {
 public:
     QVector <SequenceItem *> items;
+    QByteArray raw; // Undecoded value of the whole sequence, items point into it
+    bool implicit; // Whether the items are implicit VR, by transfer syntax or inside an undefined length UN
+    Sequence();
     ~Sequence();
 };
 
@@ -23,10 +26,13 @@ class SequenceItem {
 public:
     unsigned long int vl; // Value Length
     unsigned char *vf; // Value Field
+    unsigned long int offset; // Where vf starts within the parent Sequence::raw
+    bool owned; // Whether vf was allocated for this item or is a view into raw
     Sequence seq; // Contains potential sequences
 
     SequenceItem(unsigned long int size, unsigned char *data);
     SequenceItem(unsigned long int size, Attribute *data);
+    SequenceItem(unsigned long int size, unsigned long int off, Sequence *parent);
     ~SequenceItem();
 };
 
@@ -87,15 +93,147 @@ public:
 
 	// file location for later lookup
 	QString path;
+	
+	// Groups to skip while parsing, private groups (odd) and overlays (60xx)
+	// can be big and are skipped whole when a group length is present
+	QVector <unsigned short int> skipGroups;
+	bool skipPrivate = false;
+	bool skipOverlays = false;
 
     DICOM(database *);
     ~DICOM();
 
     int parse(QString p);
-    int readSequence(QDataStream *in, Attribute *att);
-    int readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n = 0);
+    int parse(const unsigned char *buf, unsigned long int n); // In memory object, not copied
+    int parse(QIODevice *device); // Open file, buffer, pipe or stdin
+    int parseStream(QDataStream *in);
+    int readSequence(QDataStream *in, Attribute *att, bool implicit);
+    int readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n, bool implicit);
+	
+	int parseSequence(QDataStream *in, QVector <Attribute*> *att, bool implicit);
+	
+	// Item offset table, sequences are only indexed while parsing and items
+	// are decoded on demand (safe to call from several threads at once)
+	unsigned long int elementHeader(const unsigned char *buf, unsigned long int n, unsigned long int *length);
+	unsigned long int elementHeader(const unsigned char *buf, unsigned long int n, unsigned long int *length, bool implicit);
+	unsigned long int elementSize(const unsigned char *buf, unsigned long int n);
+	unsigned long int elementSize(const unsigned char *buf, unsigned long int n, bool implicit);
+	int copyElement(QDataStream *in, const unsigned char *head, QByteArray *raw);
+	int copyElement(QDataStream *in, const unsigned char *head, QByteArray *raw, bool implicit);
+	bool isSkipped(unsigned short int group);
+	int skipElement(QDataStream *in, const unsigned char *head);
+	int indexSequence(Sequence *seq);
+	int parseItem(Sequence *seq, int i, QVector <Attribute*> *att);
+};
+
+// A tag path through nested sequences, such as (3006,0039)[*]/(3006,0040)[*]/(3006,0050),
+// every step but the last is a sequence followed by the item to look in, with
+// [*] (or nothing) matching all of them
+class TagPath {
+public:
+	QVector <unsigned short int> group, element;
+	QVector <int> item; // -1 for any item
+	bool valid;
+	
+	TagPath(QString path = "");
+};
+
+// A value found by a TagQuery, vf points straight into the DICOM data so it is
+// only good for as long as that DICOM is
+class ValueView {
+public:
+	const unsigned char *vf; // Value Field
+	unsigned long int vl; // Value Length
+	int path; // Index of the matching path in the query
+	QVector <int> items; // Item taken at each sequence along the way
+	
+	QString toString() const;
+};
+
+// A set of tag paths compiled once, then evaluated in a single pass over each
+// dataset, only the items along a matching path are ever looked at
+class TagQuery {
+public:
+	QVector <TagPath> paths;
+	
+	int add(QString path); // Returns the index of the path, or -1 if it is malformed
+	int run(DICOM *dicom, QVector <ValueView> *result);
+	int run(QVector <DICOM *> &dicom, QVector <QVector <ValueView> > *result); // In parallel
+	
+private:
+	int walk(DICOM *dicom, const unsigned char *buf, unsigned long int n, int depth, bool implicit,
+			 QVector <int> &active, QVector <int> &items, QVector <ValueView> *result);
+	int walkSequence(DICOM *dicom, const unsigned char *buf, unsigned long int n, int depth, bool implicit,
+					 QVector <int> &active, QVector <int> &items, QVector <ValueView> *result);
+};
+
+// Writes a DICOM file one element at a time, VRs come from the same dictionary
+// the parser uses, values are padded to even length, group lengths are filled
+// in once their group is done and large values are written straight from the
+// caller's memory
+class DICOMWriter {
+public:
+    // Pointer to precompiled DICOM library
+    database *lib;
+	
+	// Transfer syntax for everything outside group 0002 (always explicit)
+    bool isImplicit;
+	
+	// Also write group lengths outside group 0002 (where they are required)
+	bool groupLengths = false;
+	
+	// Text for the 128 byte preamble, padded with spaces
+	QByteArray preamble;
+	
+    DICOMWriter(database *l);
+    ~DICOMWriter();
+	
+	int open(QString p, bool implicit = true); // Writes the preamble and DICM
+	int open(QIODevice *d, bool implicit = true); // d must be open and seekable
+	int close(); // Fills in the last group length
+	
+	// Typed values, strings are padded with spaces (UI with a null)
+	int writeString(unsigned short int g, unsigned short int e, QString value);
+	int writeUS(unsigned short int g, unsigned short int e, unsigned short int value);
+	int writeUL(unsigned short int g, unsigned short int e, unsigned int value);
+	int writeAT(unsigned short int g, unsigned short int e, unsigned short int g2, unsigned short int e2);
+	int writeIS(unsigned short int g, unsigned short int e, int value);
+	int writeDS(unsigned short int g, unsigned short int e, QVector <double> values);
+	
+	// Any value as is, the data is not copied, VR may be left empty for a
+	// dictionary lookup
+	int writeElement(unsigned short int g, unsigned short int e, QString VR,
+					 const unsigned char *data, unsigned long int n);
+	
+	// A whole element of group g that is already encoded (header and all) in
+	// the output transfer syntax, such as encapsulated pixel data
+	int writeRaw(unsigned short int g, const unsigned char *data, unsigned long int n);
+	
+	// A value written in pieces, n is the total length
+	int beginValue(unsigned short int g, unsigned short int e, QString VR, unsigned long int n);
+	int writeValue(const unsigned char *data, unsigned long int n);
+	int endValue();
+	
+	// Sequences and items are written with undefined length and delimiters
+	int beginSequence(unsigned short int g, unsigned short int e);
+	int beginItem();
+	int endItem();
+	int endSequence();
+	
+private:
+	QIODevice *device;
+	QFile *file; // Only if we opened it
+	QDataStream out;
+	int depth; // Sequence nesting
+	unsigned short int group; // Group currently being written at the top level
+	qint64 groupStart; // Where its group length value is, or -1 for none
+	unsigned long int valueLength; // Of the value being written in pieces
+	QString valueVR;
 	
-	int parseSequence(QDataStream *in, QVector <Attribute*> *att);
+	QString lookupVR(unsigned short int g, unsigned short int e);
+	int startElement(unsigned short int g);
+	int writeHeader(unsigned short int g, unsigned short int e, QString VR, unsigned long int n);
+	int finishGroup();
 };
 
 #endif
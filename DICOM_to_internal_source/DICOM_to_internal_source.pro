@@ -2,7 +2,7 @@
 # Automatically generated by qmake (3.1) Wed May 6 14:50:05 2020
 ######################################################################
 
-QT+=widgets
+QT+=widgets concurrent
 TEMPLATE = app
 TARGET = DICOM_to_internal_source
 INCLUDEPATH += .
@@ -19,5 +19,5 @@ DEFINES += QT_DEPRECATED_WARNINGS
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
 # Input
-HEADERS += DICOM.h egsphant.h
-SOURCES += database.cpp DICOM.cpp egsphant.cpp main.cpp
+HEADERS += DICOM.h egsphant.h grid.h resample.h textreader.h volume.h
+SOURCES += database.cpp DICOM.cpp query.cpp writer.cpp egsphant.cpp resample.cpp textreader.cpp main.cpp
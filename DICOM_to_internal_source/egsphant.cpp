@@ -13,6 +13,65 @@
 ***********************************************************************/
 
 #include "egsphant.h"
+#include "textreader.h"
+
+// Read the media, dimensions and boundaries of a text egsphant file, returns
+// 0 if any are missing
+static int readEGSPhantHeader(TextReader &input, EGSPhant *p) {
+    // read in the number of media
+    int num = input.readLine().trimmed().toInt();
+    p->media.resize(num);
+
+    // read the media into an array
+    for (int i = 0; i < num; i++)
+        p->media[i] = QString(input.readLine()).trimmed();
+
+    // skim over the the ESTEP info
+    input.readLine();
+
+    // read in the dimensions of the egsphant file and
+    // store the size and resize the matrices holding the boundaries
+    int n[3];
+    if (input.readNumbers(n, 3) != 3 || n[0] < 0 || n[1] < 0 || n[2] < 0)
+        return 0;
+    p->nx = n[0];
+    p->ny = n[1];
+    p->nz = n[2];
+    p->x.fill(0, p->nx+1);
+    p->y.fill(0, p->ny+1);
+    p->z.fill(0, p->nz+1);
+
+    // read in all the boundaries of the phantom
+    if (input.readNumbers(p->x.data(), p->nx+1) != p->nx+1 ||
+        input.readNumbers(p->y.data(), p->ny+1) != p->ny+1 ||
+        input.readNumbers(p->z.data(), p->nz+1) != p->nz+1)
+        return 0;
+    p->updateGrid();
+    return 1;
+}
+
+// Report a text egsphant file that ends early or holds something other than
+// a number where one should be, and leave p empty
+static void failEGSPhantText(EGSPhant *p, QString path, QString section) {
+    std::cout << "Could not read the " << section.toStdString() << " of " << path.toStdString()
+              << ", the file is short or malformed, quitting...\n";
+    p->nx = p->ny = p->nz = 0;
+    p->m.clear();
+    p->d.clear();
+}
+
+// Resize the 3D matrices to hold all media and densities, returns 0 and leaves
+// p empty if there is not enough memory
+static int allocateEGSPhant(EGSPhant *p, QString path) {
+    if (p->m.resize(p->nx, p->ny, p->nz, 0) && p->d.resize(p->nx, p->ny, p->nz, 0))
+        return 1;
+
+    std::cout << "Not enough memory to load " << path.toStdString() << ", quitting...\n";
+    p->nx = p->ny = p->nz = 0;
+    p->m.clear();
+    p->d.clear();
+    return 0;
+}
 
 EGSPhant::EGSPhant() {
     nx = ny = nz = 0;
@@ -27,182 +86,114 @@ void EGSPhant::makeMask(EGSPhant* mask) {
 	y = mask->y;
 	z = mask->z;
     maxDensity = mask->maxDensity;
-	{
-		QVector <char> mz(nz, 49);
-		QVector <QVector <char> > my(ny, mz);
-		QVector <QVector <QVector <char> > > mx(nx, my);
-		m = mx;
-		QVector <double> dz(nz, 0);
-		QVector <QVector <double> > dy(ny, dz);
-		QVector <QVector <QVector <double> > > dx(nx, dy);
-		d = dx;
+    updateGrid();
+	if (!m.resize(nx, ny, nz, 49) || !d.resize(nx, ny, nz, 0)) {
+		nx = ny = nz = 0; // Not enough memory, left empty
+		m.clear();
+		d.clear();
 	}
     media << "OTHER" << "TARGET";
 }
 
 void EGSPhant::loadEGSPhantFile(QString path) {
-    QFile file(path);
+    TextReader input;
 
     // Increment size of the status bar
     double increment;
 
     // Open up the file specified at path
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream input(&file);
-        QString line = input.readLine();
-
-        // read in the number of media
-        int num = line.trimmed().toInt();
-        media.resize(num);
-
-        // read the media into an array
-        for (int i = 0; i < num; i++) {
-            media[i] = input.readLine().trimmed();
-        }
-
-        // skim over the the ESTEP info
-        line = input.readLine().trimmed();
-
-        // read in the dimensions of the egsphant file and
-        // store the size and resize the matrices holding the boundaries
-        input.skipWhiteSpace();
-        input >> nx;
-        x.fill(0,nx+1);
-        input.skipWhiteSpace();
-        input >> ny;
-        y.fill(0,ny+1);
-        input.skipWhiteSpace();
-        input >> nz;
-        z.fill(0,nz+1);
-
-        // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
-
-        // read in all the boundaries of the phantom
-        input.skipWhiteSpace();
-        for (int i = 0; i <= nx; i++) {
-            input >> x[i];
-        }
-        for (int i = 0; i <= ny; i++) {
-            input >> y[i];
-        }
-        for (int i = 0; i <= nz; i++) {
-            input >> z[i];
+    if (input.open(path)) {
+        if (!readEGSPhantHeader(input, this)) {
+            failEGSPhantText(this, path, "header");
+            return;
         }
+        if (!allocateEGSPhant(this, path))
+            return;
 
         // Determine the increment this egsphant file gets
         increment = MAX_PROGRESS/double(nz-1);
 
-        // Read in all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input.skipWhiteSpace();
-                    input >> m[i][j][k];
-                }
-            emit progressMade(increment); // Update progress bar
+        // Read in all the media, a batch of slices at a time
+        int batch = qMax(1, (1 << 22)/qMax(1, nx*ny));
+        for (int k = 0; k < nz; k += batch) {
+            int k1 = qMin(nz, k+batch);
+            qint64 count = qint64(k1-k)*nx*ny;
+            if (input.readChars(m.slice(k), count) != count) {
+                failEGSPhantText(this, path, "media");
+                return;
+            }
+            for (int s = k; s < k1; s++)
+                emit progressMade(increment); // Update progress bar
+            m.release(k, k1);
         }
 
-        file.close();
+        // The media should end with a row, not part way into the densities
+        if (!input.atTokenEnd()) {
+            failEGSPhantText(this, path, "media");
+            return;
+        }
+
+        input.close();
     }
 }
 
 void EGSPhant::loadEGSPhantFilePlus(QString path) {
-    QFile file(path);
+    TextReader input;
 
     // Increment size of the status bar
     double increment;
 
     // Open up the file specified at path
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream input(&file);
-        QString line = input.readLine();
-
-        // read in the number of media
-        int num = line.trimmed().toInt();
-        media.resize(num);
-
-        // read the media into an array
-        for (int i = 0; i < num; i++) {
-            media[i] = input.readLine().trimmed();
-        }
-
-        // skim over the the ESTEP info
-        line = input.readLine().trimmed();
-
-        // read in the dimensions of the egsphant file
-        input.skipWhiteSpace();
-        input >> nx;
-        x.fill(0,nx+1);
-        input.skipWhiteSpace();
-        input >> ny;
-        y.fill(0,ny+1);
-        input.skipWhiteSpace();
-        input >> nz;
-        z.fill(0,nz+1);
-
-        // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
-
-        // read in all the boundaries of the phantom
-        input.skipWhiteSpace();
-        for (int i = 0; i <= nx; i++) {
-            input >> x[i];
-        }
-        for (int i = 0; i <= ny; i++) {
-            input >> y[i];
-        }
-        for (int i = 0; i <= nz; i++) {
-            input >> z[i];
+    if (input.open(path)) {
+        if (!readEGSPhantHeader(input, this)) {
+            failEGSPhantText(this, path, "header");
+            return;
         }
+        if (!allocateEGSPhant(this, path))
+            return;
 
         // Determine the increment this egsphant file gets
         increment = MAX_PROGRESS/double(nz-1);
 
-        // Read in all the media
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input.skipWhiteSpace();
-                    input >> m[i][j][k];
-                }
-            emit progressMade(increment/100.0*10.0); // Update progress bar
+        // Read in all the media, a batch of slices at a time
+        int batch = qMax(1, (1 << 22)/qMax(1, nx*ny));
+        for (int k = 0; k < nz; k += batch) {
+            int k1 = qMin(nz, k+batch);
+            qint64 count = qint64(k1-k)*nx*ny;
+            if (input.readChars(m.slice(k), count) != count) {
+                failEGSPhantText(this, path, "media");
+                return;
+            }
+            for (int s = k; s < k1; s++)
+                emit progressMade(increment/100.0*10.0); // Update progress bar
+            m.release(k, k1);
         }
 
-        // Read in all the densities
-        maxDensity = 0;
-        for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input.skipWhiteSpace();
-                    input >> d[i][j][k];
-                    if (d[i][j][k] > maxDensity) {
-                        maxDensity = d[i][j][k];
-                    }
+        // The media should end with a row, not part way into the densities
+        if (!input.atTokenEnd()) {
+            failEGSPhantText(this, path, "media");
+            return;
+        }
 
-                }
-            emit progressMade(increment/100.0*90.0); // Update progress bar
+        // Read in all the densities, which are parsed in parallel
+        maxDensity = 0;
+        for (int k = 0; k < nz; k += batch) {
+            int k1 = qMin(nz, k+batch);
+            qint64 count = qint64(k1-k)*nx*ny;
+            double *v = d.slice(k);
+            if (input.readNumbers(v, count) != count) {
+                failEGSPhantText(this, path, "densities");
+                return;
+            }
+            for (qint64 n = 0; n < count; n++)
+                if (v[n] > maxDensity)
+                    maxDensity = v[n];
+            for (int s = k; s < k1; s++)
+                emit progressMade(increment/100.0*90.0); // Update progress bar
+            d.release(k, k1);
         }
 
-        file.close();
+        input.close();
     }
 }
 
@@ -255,12 +246,11 @@ void EGSPhant::saveEGSPhantFile(QString path) {
         // Read out all the media
         for (int k = 0; k < nz; k++) {
             for (int j = 0; j < ny; j++) {
-                for (int i = 0; i < nx; i++) {
-                    output << m[i][j][k];
-                }
+                output << QLatin1String(m.row(j,k), nx); // A whole row at once
 				output << "\n";
 			}
             emit progressMade(increment/100.0*10.0); // Update progress bar
+            m.release(k, k+1);
             output << "\n";
         }
 
@@ -268,11 +258,12 @@ void EGSPhant::saveEGSPhantFile(QString path) {
         for (int k = 0; k < nz; k++) {
             for (int j = 0; j < ny; j++) {
                 for (int i = 0; i < nx; i++) {
-                    output << d[i][j][k] << " ";
+                    output << d(i,j,k) << " ";
                 }
 				output << "\n";
             }
             emit progressMade(increment/100.0*90.0); // Update progress bar
+            d.release(k, k+1);
             output << "\n";
         }
 
@@ -319,15 +310,9 @@ void EGSPhant::loadbEGSPhantFile(QString path) {
         z.fill(0,nz+1);
 
         // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
+        if (!allocateEGSPhant(this, path)) {
+            file.close();
+            return;
         }
 
         // read in all the boundaries of the phantom
@@ -340,18 +325,16 @@ void EGSPhant::loadbEGSPhantFile(QString path) {
         for (int i = 0; i <= nz; i++) {
             input >> z[i];
         }
+        updateGrid();
 
         // Determine the increment this egsphant file gets
         increment = MAX_PROGRESS/double(nz-1);
 
         // Read in all the media
         for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input >> num;
-                    m[i][j][k] = num;
-                }
+            input.readRawData(m.slice(k), nx*ny); // A whole slice at once
             emit progressMade(increment); // Update progress bar
+            m.release(k, k+1);
         }
 
         file.close();
@@ -397,15 +380,9 @@ void EGSPhant::loadbEGSPhantFilePlus(QString path) {
         z.fill(0,nz+1);
 
         // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
+        if (!allocateEGSPhant(this, path)) {
+            file.close();
+            return;
         }
 
         // read in all the boundaries of the phantom
@@ -418,18 +395,16 @@ void EGSPhant::loadbEGSPhantFilePlus(QString path) {
         for (int i = 0; i <= nz; i++) {
             input >> z[i];
         }
+        updateGrid();
 
         // Determine the increment this egsphant file gets
         increment = MAX_PROGRESS/double(nz-1);
 
         // Read in all the media
         for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++) {
-                    input >> num;
-                    m[i][j][k] = num;
-                }
+            input.readRawData(m.slice(k), nx*ny); // A whole slice at once
             emit progressMade(increment/100.0*50.0); // Update progress bar
+            m.release(k, k+1);
         }
 
         // Read in all the densities
@@ -437,12 +412,13 @@ void EGSPhant::loadbEGSPhantFilePlus(QString path) {
         for (int k = 0; k < nz; k++) {
             for (int j = 0; j < ny; j++)
                 for (int i = 0; i < nx; i++) {
-                    input >> d[i][j][k];
-                    if (d[i][j][k] > maxDensity) {
-                        maxDensity = d[i][j][k];
+                    input >> d(i,j,k);
+                    if (d(i,j,k) > maxDensity) {
+                        maxDensity = d(i,j,k);
                     }
                 }
             emit progressMade(increment/100.0*50.0); // Update progress bar
+            d.release(k, k+1);
         }
 
         file.close();
@@ -493,18 +469,18 @@ void EGSPhant::savebEGSPhantFile(QString path) {
 
         // Read out all the media
         for (int k = 0; k < nz; k++) {
-            for (int j = 0; j < ny; j++)
-                for (int i = 0; i < nx; i++)
-                    output << m[i][j][k];
+            output.writeRawData(m.slice(k), nx*ny); // A whole slice at once
             emit progressMade(increment/100.0*50.0); // Update progress bar
+            m.release(k, k+1);
         }
 
         // Read out all the densities
         for (int k = 0; k < nz; k++) {
             for (int j = 0; j < ny; j++)
                 for (int i = 0; i < nx; i++)
-                    output << d[i][j][k];
+                    output << d(i,j,k);
             emit progressMade(increment/100.0*50.0); // Update progress bar
+            d.release(k, k+1);
         }
 
         file.close();
@@ -512,80 +488,24 @@ void EGSPhant::savebEGSPhantFile(QString path) {
 }
 
 char EGSPhant::getMedia(double px, double py, double pz) {
-    int ix, iy, iz;
-    ix = iy = iz = -1;
-
-    // Find the index of the boundary that is less than px, py and pz
-    for (int i = 0; i < nx; i++)
-        if (px <= x[i+1]) {
-            ix = i;
-            break;
-        }
-    if (px < x[0]) {
-        ix = -1;
-    }
-
-    for (int i = 0; i < ny; i++)
-        if (py <= y[i+1]) {
-            iy = i;
-            break;
-        }
-    if (py < y[0]) {
-        iy = -1;
-    }
-
-    for (int i = 0; i < nz; i++)
-        if (pz <= z[i+1]) {
-            iz = i;
-            break;
-        }
-    if (pz < z[0]) {
-        iz = -1;
-    }
+    // Find the index of the voxel holding px, py and pz
+    int ix = gx.upper(px), iy = gy.upper(py), iz = gz.upper(pz);
 
     // This is to insure that no area outside the vectors is accessed
     if (ix < nx && ix >= 0 && iy < ny && iy >= 0 && iz < nz && iz >= 0) {
-        return m[ix][iy][iz];
+        return m(ix,iy,iz);
     }
 
     return 0; // We are not within our bounds
 }
 
 double EGSPhant::getDensity(double px, double py, double pz) {
-    int ix, iy, iz;
-    ix = iy = iz = -1;
-
-    // Find the index of the boundary that is less than px, py and pz
-    for (int i = 0; i < nx; i++)
-        if (px <= x[i+1]) {
-            ix = i;
-            break;
-        }
-    if (px < x[0]) {
-        ix = -1;
-    }
-
-    for (int i = 0; i < ny; i++)
-        if (py <= y[i+1]) {
-            iy = i;
-            break;
-        }
-    if (py < y[0]) {
-        iy = -1;
-    }
-
-    for (int i = 0; i < nz; i++)
-        if (pz <= z[i+1]) {
-            iz = i;
-            break;
-        }
-    if (pz < z[0]) {
-        iz = -1;
-    }
+    // Find the index of the voxel holding px, py and pz
+    int ix = gx.upper(px), iy = gy.upper(py), iz = gz.upper(pz);
 
     // This is to insure that no area outside the vectors is accessed
     if (ix < nx && ix >= 0 && iy < ny && iy >= 0 && iz < nz && iz >= 0) {
-        return d[ix][iy][iz];
+        return d(ix,iy,iz);
     }
 
     return 0; // We are not within our bounds
@@ -602,7 +522,7 @@ double EGSPhant::interpDen(double xp, double yp, double zp) {
     int xi, yi, zi;
 
     // Define X
-    xi = getIndex("x axis", xp);
+    xi = getIndex(XAxis, xp);
     if (xp < (x[xi] + x[xi-1])/2.0) {
         x0 = (x[xi] + x[xi-1])/2.0;
         x1 = (x[xi] + x[xi+1])/2.0;
@@ -613,7 +533,7 @@ double EGSPhant::interpDen(double xp, double yp, double zp) {
     }
 
     // Define Y
-    yi = getIndex("y axis", yp);
+    yi = getIndex(YAxis, yp);
     if (yp < (y[yi] + y[yi-1])/2.0) {
         y0 = (y[yi] + y[yi-1])/2.0;
         y1 = (y[yi] + y[yi+1])/2.0;
@@ -624,7 +544,7 @@ double EGSPhant::interpDen(double xp, double yp, double zp) {
     }
 
     // Define Z
-    zi = getIndex("z axis", zp);
+    zi = getIndex(ZAxis, zp);
     if (zp < (z[zi] + z[zi-1])/2.0) {
         z0 = (z[zi] + z[zi-1])/2.0;
         z1 = (z[zi] + z[zi+1])/2.0;
@@ -681,40 +601,35 @@ double EGSPhant::interpDen(double xp, double yp, double zp) {
 }
 
 int EGSPhant::getIndex(QString axis, double p) {
-    int index = -1;
+    if (!axis.compare("x axis"))
+        return getIndex(XAxis, p);
+    else if (!axis.compare("y axis"))
+        return getIndex(YAxis, p);
+    else if (!axis.compare("z axis"))
+        return getIndex(ZAxis, p);
+    return -1;
+}
 
-    if (!axis.compare("x axis")) {
-        for (int i = 0; i < nx; i++)
-            if (p <= x[i+1]) {
-                index = i;
-                break;
-            }
-        if (p < x[0]) {
-            index = -1;
-        }
-    }
-    else if (!axis.compare("y axis")) {
-        for (int i = 0; i < ny; i++)
-            if (p <= y[i+1]) {
-                index = i;
-                break;
-            }
-        if (p < y[0]) {
-            index = -1;
-        }
-    }
-    else if (!axis.compare("z axis")) {
-        for (int i = 0; i < nz; i++)
-            if (p <= z[i+1]) {
-                index = i;
-                break;
-            }
-        if (p < z[0]) {
-            index = -1;
-        }
-    }
+int EGSPhant::getIndex(Axis axis, double p) {
+    if (axis == XAxis)
+        return gx.upper(p);
+    else if (axis == YAxis)
+        return gy.upper(p);
+    return gz.upper(p); // -1 if we are out of bounds
+}
 
-    return index; // -1 if we are out of bounds
+void EGSPhant::updateGrid() {
+    gx.build(x);
+    gy.build(y);
+    gz.build(z);
+}
+
+void EGSPhant::getPlane(Axis axis, int n, QVector <char> *out) {
+    extractPlane(m, axis, n, out);
+}
+
+void EGSPhant::getPlane(Axis axis, int n, QVector <double> *out) {
+    extractPlane(d, axis, n, out);
 }
 
 QImage EGSPhant::getEGSPhantPicMed(QString axis, double ai, double af,
@@ -724,7 +639,7 @@ QImage EGSPhant::getEGSPhantPicMed(QString axis, double ai, double af,
     int height = (bf-bi)*res;
     QImage image(height, width, QImage::Format_RGB32);
     double hInc, wInc, cInc;
-    double h, w, c = 0;
+    double c = 0;
 	
 	// Get the axis
 	int ax;
@@ -742,29 +657,46 @@ QImage EGSPhant::getEGSPhantPicMed(QString axis, double ai, double af,
     hInc = 1/res;
     cInc = 255.0/(media.size()-1);
 
+    // Find the voxel of each image row and column once, rather than per pixel
+    GridAxis *dAxis = ax == 1 ? &gx : (ax == 2 ? &gy : &gz);
+    GridAxis *hAxis = ax == 1 ? &gy : &gx;
+    GridAxis *wAxis = ax == 3 ? &gy : &gz;
+    QVector <int> hIndex(height), wIndex(width);
     for (int i = 0; i < height; i++)
-        for (int j = 0; j < width; j++) {
-            // determine the location of the current pixel in the phantom
-            h = (double(bi)) + hInc * double(i);
-            w = (double(ai)) + wInc * double(j);
-
-            // get the media, which differs based on axis through which image is
-            // sliced
-            if (ax == 1) {
-                c = getMedia(d, h, w) - 49;
-				c -= (c>9?17:0);
-            }
-            else if (ax == 2) {
-                c = getMedia(h, d, w) - 49;
-				c -= (c>9?17:0);
-            }
-            else if (ax == 3) {
-                c = getMedia(h, w, d) - 49;
-				c -= (c>9?17:0);
-            }
-            // finally, paint the pixel
-            image.setPixel(i, width-1-j, qRgb(int(cInc*c), int(cInc*c), int(cInc*c)));
-        }
+        hIndex[i] = hAxis->upper((double(bi)) + hInc * double(i));
+    for (int j = 0; j < width; j++)
+        wIndex[j] = wAxis->upper((double(ai)) + wInc * double(j));
+    int dIndex = dAxis->upper(d);
+
+    // Copy out the whole plane once, image columns run along its second axis
+    QVector <char> plane;
+    int pw = ax == 1 ? ny : nx;
+    if (dIndex >= 0)
+        getPlane(Axis(ax-1), dIndex, &plane);
+
+    // The grey of every media character, 0 being outside the phantom
+    QRgb grey[256];
+    for (int n = 0; n < 256; n++) {
+        c = char(n);
+        c -= 49;
+        c -= (c>9?17:0);
+        grey[n] = qRgb(int(cInc*c), int(cInc*c), int(cInc*c));
+    }
+
+    // Each image row is one voxel row of the plane, so write it straight in
+    QRgb *line;
+    const char *row;
+    for (int j = 0; j < width; j++) {
+        line = (QRgb*)image.scanLine(width-1-j);
+        if (dIndex < 0 || wIndex[j] < 0) {
+            for (int i = 0; i < height; i++)
+                line[i] = grey[0];
+            continue;
+        }
+        row = plane.constData()+wIndex[j]*pw;
+        for (int i = 0; i < height; i++)
+            line[i] = grey[hIndex[i] >= 0 ? (unsigned char)row[hIndex[i]] : 0];
+    }
 
     return image; // return the image created
 }
@@ -776,7 +708,7 @@ QImage EGSPhant::getEGSPhantPicDen(QString axis, double ai, double af,
     int height = (bf-bi)*res;
     QImage image(height, width, QImage::Format_RGB32);
     double hInc, wInc, cInc;
-    double h, w, c = 0;
+    double c = 0;
 
 	// Get the axis
 	int ax;
@@ -794,27 +726,35 @@ QImage EGSPhant::getEGSPhantPicDen(QString axis, double ai, double af,
     hInc = 1/res;
     cInc = 255.0/maxDensity;
 
+    // Find the voxel of each image row and column once, rather than per pixel
+    GridAxis *dAxis = ax == 1 ? &gx : (ax == 2 ? &gy : &gz);
+    GridAxis *hAxis = ax == 1 ? &gy : &gx;
+    GridAxis *wAxis = ax == 3 ? &gy : &gz;
+    QVector <int> hIndex(height), wIndex(width);
     for (int i = 0; i < height; i++)
-        for (int j = 0; j < width; j++) {
-            // determine the location of the current pixel in the phantom
-            h = (double(bi)) + hInc * double(i);
-            w = (double(ai)) + wInc * double(j);
-
-            // get the density, which differs based on axis through which image
-            // os sliced
-            if (ax == 1) {
-                c = getDensity(d, h, w);
-            }
-            else if (ax == 2) {
-                c = getDensity(h, d, w);
-            }
-            else if (ax == 3) {
-                c = getDensity(h, w, d);
-            }
-
-            // finally, paint the pixel
-            image.setPixel(i, width-1-j, qRgb(int(cInc*c), int(cInc*c), int(cInc*c)));
+        hIndex[i] = hAxis->upper((double(bi)) + hInc * double(i));
+    for (int j = 0; j < width; j++)
+        wIndex[j] = wAxis->upper((double(ai)) + wInc * double(j));
+    int dIndex = dAxis->upper(d);
+
+    // Copy out the whole plane once, image columns run along its second axis
+    QVector <double> plane;
+    int pw = ax == 1 ? ny : nx;
+    if (dIndex >= 0)
+        getPlane(Axis(ax-1), dIndex, &plane);
+
+    // Each image row is one voxel row of the plane, so write it straight in
+    QRgb *line;
+    const double *row;
+    for (int j = 0; j < width; j++) {
+        line = (QRgb*)image.scanLine(width-1-j);
+        row = (dIndex >= 0 && wIndex[j] >= 0) ? plane.constData()+wIndex[j]*pw : NULL;
+        for (int i = 0; i < height; i++) {
+            // get the density, 0 outside the phantom
+            c = (row != NULL && hIndex[i] >= 0) ? row[hIndex[i]] : 0;
+            line[i] = qRgb(int(cInc*c), int(cInc*c), int(cInc*c));
         }
+    }
 
     return image; // return the image created
 }
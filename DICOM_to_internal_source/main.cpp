@@ -1,4 +1,5 @@
 #include "DICOM.h"
+#include "resample.h"
 
 double interp(double x, double x1, double x2, double y1, double y2) {
 	return (y2*(x-x1)+y1*(x2-x))/(x2-x1);
@@ -89,15 +90,25 @@ int main(int argc, char **argv) {
 	filterLowActivity=Y sets any activity below Y*maxActivity equal
 	to zero.
 	
+	interpolation=Z sets how activity is resampled onto phant, Z
+	being nearest, linear (the default), cubic or overlap.  Overlap
+	averages activity over each phant voxel, which conserves total
+	activity.
+	
 	outputImages outputs PNGs of each slice of the output phantoms
 	for both media and density, as well as a blue->red wash of 
 	activity assigned to phant in Activity.txt.  It is very time
 	intensive, so best to be used to check activity and
 	registration.
+	
+	scratch=path keeps very large volumes in memory mapped files
+	in the directory path rather than in memory, it must be given
+	before the egsphant file to apply to it.
 	*/
 	bool outputImages = false;
 	double filterLowDensity = 0;
 	double filterLowActivity = 0.01;
+	Resampler::Mode interpolation = Resampler::Trilinear;
 	
 	if (argc == 1) {
         std::cout << "Please call this program with one or more .dcm files and a .egsphant or .begsphant file.\n";
@@ -117,12 +128,30 @@ int main(int argc, char **argv) {
 			filterLowDensity = path.right(path.size()-17).toDouble();
         else if (!path.left(18).compare("filterLowActivity="))
 			filterLowActivity = path.right(path.size()-18).toDouble();
+        else if (!path.left(14).compare("interpolation=")) {
+			QString mode = path.right(path.size()-14);
+			if (!mode.compare("nearest"))
+				interpolation = Resampler::Nearest;
+			else if (!mode.compare("linear"))
+				interpolation = Resampler::Trilinear;
+			else if (!mode.compare("cubic"))
+				interpolation = Resampler::Cubic;
+			else if (!mode.compare("overlap"))
+				interpolation = Resampler::Overlap;
+			else {
+				std::cout << "Unknown interpolation " << mode.toStdString() << ", quitting...\n";
+				return -1;
+			}
+		}
+        else if (!path.left(8).compare("scratch="))
+			volumeScratchDir() = path.right(path.size()-8);
         else if (path.endsWith(".egsphant"))
 			phant.loadEGSPhantFilePlus(path);
 		else if (path.endsWith(".begsphant"))
 			phant.loadbEGSPhantFilePlus(path);			
 		else {			
 			DICOM *d = new DICOM(&dat);
+			d->skipPrivate = d->skipOverlays = true; // Vendor data and overlays are never used
 			if (d->parse(path)) {
 				dicom.append(d);
 			}
@@ -370,15 +399,10 @@ int main(int argc, char **argv) {
     activity.x.fill(0,activity.nx+1);
     activity.y.fill(0,activity.ny+1);
     activity.z.fill(0,activity.nz+1);
-	{
-		QVector <char> mz(activity.nz, 1);
-		QVector <QVector <char> > my(activity.ny, mz);
-		QVector <QVector <QVector <char> > > mx(activity.nx, my);
-		activity.m = mx;
-		QVector <double> dz(activity.nz, 0);
-		QVector <QVector <double> > dy(activity.ny, dz);
-		QVector <QVector <QVector <double> > > dx(activity.nx, dy);
-		activity.d = dx;
+	if (!activity.m.resize(activity.nx, activity.ny, activity.nz, 1) ||
+		!activity.d.resize(activity.nx, activity.ny, activity.nz, 0)) {
+		std::cout << "Not enough memory for the activity matrix, quitting...\n";
+		return -1;
 	}
 	activity.media.append("DUMMY");
 	
@@ -397,6 +421,7 @@ int main(int argc, char **argv) {
 		activity.z[i] = prevZ/10.0;
 	}
 	activity.z.last() = nextZ/10.0;
+	activity.updateGrid(); // Done with the boundaries
 	
 	// Write HU into density array (which is actually activity)
 	double maxAct = 0;
@@ -405,7 +430,7 @@ int main(int argc, char **argv) {
 		for (int j = 0; j < activity.ny; j++) { // Y //
 			nj = activity.ny-1-j; // Reversed j index for density and media assignment
 			for (int i = 0; i < activity.nx; i++) { // X //
-				activity.d[i][nj][k] = HU[k][j][i];
+				activity.d(i,nj,k) = HU[k][j][i];
 				maxAct = (maxAct<HU[k][j][i])?HU[k][j][i]:maxAct;
 			}
 		}
@@ -425,34 +450,42 @@ int main(int argc, char **argv) {
 	phant and check the activity from the DICOM data (which is
 	stored as density in the egsphant activity).
 	
-	We iterate through z, y, and x of phant.  At the center of
-	each voxel, we invoke interpDen (interpolate density) in
-	egsphant activity to find the activity at the center of the
-	phant voxel.  Then, we output the region of the voxel and the
-	activity we just computed to Activity.txt.
+	First, the activity (stored as density in the egsphant
+	activity) is resampled at the center of every phant voxel in
+	one go, using per axis lookup tables and one slice per thread.
+	
+	We then iterate through z, y, and x of phant, and output the
+	region of each voxel and the activity resampled onto it to
+	Activity.txt.
 	*/
+	
+	Volume <double> phantAct;
+	Resampler resampler(interpolation);
+	resampler.setGrids(activity.x, activity.y, activity.z, phant.x, phant.y, phant.z);
+	if (!resampler.apply(activity.d, &phantAct)) {
+		std::cout << "Not enough memory to resample the activity onto the phantom, quitting...\n";
+		return -1;
+	}
+	
+	duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+    std::cout << "Resampled activity onto the phantom.  Time elapsed is " << duration << " s.\n";
 		
 	// Output activity to file
-	double minAct = maxAct*filterLowActivity, tempAct, zMid, yMid, xMid; // Threshold cutoff defined here
+	double minAct = maxAct*filterLowActivity, tempAct, zMid; // Threshold cutoff defined here
 	QFile outputF("Activity.txt");
 	
     if (outputF.open(QIODevice::WriteOnly | QIODevice::Text)) {
         QTextStream output(&outputF);
-		for (int k = 0; k < phant.nz; k++) { // Z //
-			zMid = (phant.z[k]+phant.z[k+1])/2.0;
-			for (int j = 0; j < phant.ny; j++) { // Y //
-				yMid = (phant.y[j]+phant.y[j+1])/2.0;
+		for (int k = 0; k < phant.nz; k++) // Z //
+			for (int j = 0; j < phant.ny; j++) // Y //
 				for (int i = 0; i < phant.nx; i++) { // X //
-					if (phant.d[i][j][k] >= filterLowDensity) {
-						xMid = (phant.x[i]+phant.x[i+1])/2.0;
-						tempAct = activity.interpDen(xMid, yMid, zMid);
+					if (phant.d(i,j,k) >= filterLowDensity) {
+						tempAct = phantAct(i,j,k);
 						
 						if (tempAct > minAct)
 							output << i+j*phant.nx+k*phant.nx*phant.ny << " " << tempAct << "\n";
 					}
 				}
-			}
-		}
 	}
 	else {
 		std::cout << "Failed to open Activity.txt, quitting...\n";
@@ -488,12 +521,9 @@ int main(int argc, char **argv) {
 			
 			QPainter paintM (&tempM), paintD (&tempD);
 			for (int j = 0; j < phant.ny; j++) { // Y //
-				yMid = (phant.y[j]+phant.y[j+1])/2.0;
 				for (int i = 0; i < phant.nx; i++) { // X //
-					xMid = (phant.x[i]+phant.x[i+1])/2.0;
-					
-					tempAct = activity.interpDen(xMid, yMid, zMid);
-					if (tempAct > minAct && phant.d[i][j][k] >= filterLowDensity) {
+					tempAct = phantAct(i,j,k);
+					if (tempAct > minAct && phant.d(i,j,k) >= filterLowDensity) {
 						tempAct = (tempAct-minAct)/(maxAct-minAct);
 						tempAct = tempAct > 1.0 ? 1.0 : tempAct;
 						pen.setColor(QColor(tempAct*255.0,0,(1.0-tempAct)*255.0));
@@ -0,0 +1,225 @@
+#include "DICOM.h"
+#include <QtConcurrent>
+
+static inline unsigned short int readLE16(const unsigned char *p) {
+	return ((unsigned short int)(p[1]) << 8) + (unsigned short int)p[0];
+}
+
+static inline unsigned int readLE32(const unsigned char *p) {
+	return ((unsigned int)(p[3]) << 24) + ((unsigned int)(p[2]) << 16) +
+		   ((unsigned int)(p[1]) << 8) + (unsigned int)p[0];
+}
+
+TagPath::TagPath(QString path) {
+	valid = false;
+	if (path.isEmpty())
+		return;
+
+	QStringList steps = path.split('/');
+	for (int i = 0; i < steps.size(); i++) {
+		QString step = steps[i].trimmed(), tag = step, index = "*";
+
+		// Split off the item index
+		int bracket = step.indexOf('[');
+		if (bracket >= 0) {
+			if (!step.endsWith("]") || i == steps.size()-1) // The last step is a value, not a sequence
+				return;
+			tag = step.left(bracket);
+			index = step.mid(bracket+1, step.size()-bracket-2).trimmed();
+		}
+
+		// Read (gggg,eeee)
+		tag = tag.replace("(","").replace(")","");
+		QStringList parts = tag.split(',');
+		bool ok1, ok2;
+		if (parts.size() != 2)
+			return;
+		group.append(parts[0].trimmed().toUShort(&ok1, 16));
+		element.append(parts[1].trimmed().toUShort(&ok2, 16));
+		if (!ok1 || !ok2)
+			return;
+
+		if (i < steps.size()-1) {
+			if (!index.compare("*")) {
+				item.append(-1);
+			}
+			else {
+				item.append(index.toInt(&ok1));
+				if (!ok1 || item.last() < 0)
+					return;
+			}
+		}
+	}
+	valid = true;
+}
+
+QString ValueView::toString() const {
+	// Drop the padding to even length
+	unsigned long int n = vl;
+	while (n > 0 && (vf[n-1] == ' ' || vf[n-1] == '\0'))
+		n--;
+	return QString::fromLatin1((const char*)vf, n);
+}
+
+int TagQuery::add(QString path) {
+	TagPath compiled(path);
+	if (!compiled.valid) {
+		std::cout << "Could not compile tag path " << path.toStdString() << "\n";
+		return -1;
+	}
+	paths.append(compiled);
+	return paths.size()-1;
+}
+
+// Look for the elements of paths in active at step depth in the data elements
+// held in buf, descending into the sequences along the way
+int TagQuery::walk(DICOM *dicom, const unsigned char *buf, unsigned long int n, int depth, bool implicit,
+				   QVector <int> &active, QVector <int> &items, QVector <ValueView> *result) {
+	unsigned long int pos = 0, head, length, size;
+	QVector <int> next;
+
+	while (pos < n) {
+		head = dicom->elementHeader(buf+pos, n-pos, &length, implicit);
+		if (!head)
+			return 0;
+		if (length != (unsigned long int)0xFFFFFFFF)
+			size = head+length <= n-pos ? head+length : 0;
+		else
+			size = dicom->elementSize(buf+pos, n-pos, implicit);
+		if (!size)
+			return 0;
+
+		unsigned short int group = readLE16(buf+pos), element = readLE16(buf+pos+2);
+		next.clear();
+		for (int i = 0; i < active.size(); i++) {
+			TagPath &path = paths[active[i]];
+			if (path.group[depth] != group || path.element[depth] != element)
+				continue;
+
+			if (depth == path.group.size()-1) {
+				ValueView view;
+				view.vf = buf+pos+head;
+				view.vl = size-head;
+				view.path = active[i];
+				view.items = items;
+				result->append(view);
+			}
+			else {
+				next.append(active[i]);
+			}
+		}
+
+		// Only the sequences on a path are walked, and each of them once for all
+		// paths, an undefined length UN holds its items in implicit VR
+		bool inner = implicit || (head == 12 && buf[pos+4] == 'U' && buf[pos+5] == 'N' && length == (unsigned long int)0xFFFFFFFF);
+		if (next.size())
+			if (!walkSequence(dicom, buf+pos+head, size-head, depth+1, inner, next, items, result))
+				return 0;
+
+		pos += size;
+	}
+	return 1;
+}
+
+// Walk the items of a sequence value, handing the wanted ones to walk
+int TagQuery::walkSequence(DICOM *dicom, const unsigned char *buf, unsigned long int n, int depth, bool implicit,
+						   QVector <int> &active, QVector <int> &items, QVector <ValueView> *result) {
+	unsigned long int pos = 0, length, size;
+	QVector <int> wanted;
+
+	for (int k = 0; pos+8 <= n; k++) {
+		if (readLE16(buf+pos) == 0xFFFE && readLE16(buf+pos+2) == 0xE0DD) // sequence delimiter
+			return 1;
+		if (readLE16(buf+pos) != 0xFFFE || readLE16(buf+pos+2) != 0xE000) // Not a sequence item
+			return 0;
+
+		length = readLE32(buf+pos+4);
+		if (length != (unsigned long int)0xFFFFFFFF) {
+			size = 8+length;
+			if (size > n-pos)
+				return 0;
+		}
+		else {
+			size = dicom->elementSize(buf+pos, n-pos, implicit);
+			if (!size)
+				return 0;
+			length = size-16;
+		}
+
+		wanted.clear();
+		for (int i = 0; i < active.size(); i++)
+			if (paths[active[i]].item[depth-1] < 0 || paths[active[i]].item[depth-1] == k)
+				wanted.append(active[i]);
+
+		if (wanted.size()) {
+			items.append(k);
+			if (!walk(dicom, buf+pos+8, length, depth, implicit, wanted, items, result))
+				return 0;
+			items.removeLast();
+		}
+		pos += size;
+	}
+	return 1;
+}
+
+int TagQuery::run(DICOM *dicom, QVector <ValueView> *result) {
+	QVector <int> active, items;
+
+	// The top level elements are already split up by parse, so start from those
+	for (int j = 0; j < dicom->data.size(); j++) {
+		Attribute *att = dicom->data[j];
+
+		active.clear();
+		for (int i = 0; i < paths.size(); i++) {
+			if (paths[i].group[0] != att->tag[0] || paths[i].element[0] != att->tag[1])
+				continue;
+
+			if (paths[i].group.size() == 1) {
+				ValueView view;
+				view.vf = att->vf;
+				view.vl = att->vf == NULL ? 0 : att->vl;
+				view.path = i;
+				result->append(view);
+			}
+			else {
+				active.append(i);
+			}
+		}
+
+		if (active.size())
+			if (!walkSequence(dicom, (const unsigned char*)(att->seq.raw.constData()), att->seq.raw.size(), 1, att->seq.implicit, active, items, result))
+				return 0;
+	}
+	return 1;
+}
+
+// One dataset of a parallel run
+struct TagQueryJob {
+	TagQuery *query;
+	DICOM *dicom;
+	QVector <ValueView> result;
+	int ok;
+};
+
+static void runTagQueryJob(TagQueryJob &job) {
+	job.ok = job.query->run(job.dicom, &(job.result));
+}
+
+int TagQuery::run(QVector <DICOM *> &dicom, QVector <QVector <ValueView> > *result) {
+	QVector <TagQueryJob> jobs(dicom.size());
+	for (int i = 0; i < dicom.size(); i++) {
+		jobs[i].query = this;
+		jobs[i].dicom = dicom[i];
+	}
+
+	QtConcurrent::blockingMap(jobs, runTagQueryJob);
+
+	int ok = 1;
+	result->resize(dicom.size());
+	for (int i = 0; i < dicom.size(); i++) {
+		(*result)[i] = jobs[i].result;
+		if (!jobs[i].ok)
+			ok = 0;
+	}
+	return ok;
+}
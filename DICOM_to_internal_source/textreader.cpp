@@ -0,0 +1,189 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include <QtConcurrent>
+#include "textreader.h"
+
+// One chunk of a run of numbers, which starts and ends at whitespace (or the
+// first token of the run)
+template <class T> struct TextChunkJob {
+    const char *start, *end;
+    T *out;
+    qint64 tokens; // the number of tokens in the chunk
+    qint64 wanted; // how many of them to parse
+    qint64 parsed; // how many were
+    bool bad; // whether parsing stopped on a token that is not a number
+    const char *stop; // just past the last token parsed
+};
+
+template <class T> static void countTextChunk(TextChunkJob <T> &job) {
+    qint64 tokens = 0;
+    bool space = true;
+    for (const char *p = job.start; p < job.end; p++) {
+        tokens += space && !isTextSpace(*p);
+        space = isTextSpace(*p);
+    }
+    job.tokens = tokens;
+}
+
+template <class T> static void parseTextChunk(TextChunkJob <T> &job) {
+    const char *p = job.start, *token;
+    double v;
+    job.parsed = 0;
+    job.bad = false;
+    job.stop = p;
+    while (job.parsed < job.wanted) {
+        while (p < job.end && isTextSpace(*p))
+            p++;
+        for (token = p; p < job.end && !isTextSpace(*p); p++);
+        if (token == p)
+            return;
+        if (!parseNumber(token, p, &v)) {
+            job.bad = true;
+            return;
+        }
+        job.out[job.parsed++] = T(v);
+        job.stop = p;
+    }
+}
+
+TextReader::TextReader() {
+    text = NULL;
+    size = pos = 0;
+}
+
+TextReader::~TextReader() {
+    close();
+}
+
+int TextReader::open(QString path) {
+    close();
+    file.setFileName(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return 0;
+
+    size = file.size();
+    text = size ? (const char*)file.map(0, size) : NULL;
+    if (text == NULL) {
+        buffer = file.readAll();
+        text = buffer.constData();
+        size = buffer.size();
+    }
+    pos = 0;
+    return 1;
+}
+
+void TextReader::close() {
+    if (file.isOpen())
+        file.close(); // also unmaps
+    buffer.clear();
+    text = NULL;
+    size = pos = 0;
+}
+
+QByteArray TextReader::readLine() {
+    const char *p = pos < size ? (const char*)memchr(text+pos, '\n', size-pos) : NULL;
+    qint64 end = p == NULL ? size : p-text, next = p == NULL ? size : end+1;
+    if (end > pos && text[end-1] == '\r')
+        end--;
+    QByteArray line(text+pos, end-pos);
+    pos = next;
+    return line;
+}
+
+qint64 TextReader::readNumbers(double *out, qint64 count) {
+    return readNumbersOf(out, count);
+}
+
+qint64 TextReader::readNumbers(float *out, qint64 count) {
+    return readNumbersOf(out, count);
+}
+
+qint64 TextReader::readNumbers(int *out, qint64 count) {
+    return readNumbersOf(out, count);
+}
+
+template <class T> qint64 TextReader::readNumbersOf(T *out, qint64 count) {
+    int threads = qMax(1, QThread::idealThreadCount());
+    qint64 done = 0;
+    while (done < count) {
+        while (pos < size && isTextSpace(text[pos]))
+            pos++;
+        if (pos == size)
+            break;
+
+        // Take a block that should hold what is left (at most 64 MB), and
+        // widen it to the next whitespace
+        qint64 end = pos+qMin(qMax((count-done)*24, qint64(4096)), qint64(1) << 26);
+        for (end = qMin(end, size); end < size && !isTextSpace(text[end]); end++);
+
+        // Small blocks are not worth splitting
+        int chunks = end-pos < (1 << 20) ? 1 : threads*4;
+        QVector <TextChunkJob <T> > jobs(chunks);
+        const char *start = text+pos;
+        for (int c = 0; c < chunks; c++) {
+            jobs[c].start = start;
+            const char *stop = c == chunks-1 ? text+end : text+pos+(end-pos)*(c+1)/chunks;
+            for (stop = qMax(stop, start); stop < text+end && !isTextSpace(*stop); stop++);
+            jobs[c].end = start = stop;
+        }
+
+        // Count the tokens of each chunk to know where its numbers go, then
+        // parse them
+        if (chunks > 1)
+            QtConcurrent::blockingMap(jobs, countTextChunk <T>);
+        else
+            jobs[0].tokens = count-done;
+        qint64 first = done;
+        for (int c = 0; c < chunks; c++) {
+            jobs[c].out = out+first;
+            jobs[c].wanted = qMin(jobs[c].tokens, count-first);
+            first += jobs[c].wanted;
+        }
+        if (chunks > 1)
+            QtConcurrent::blockingMap(jobs, parseTextChunk <T>);
+        else
+            parseTextChunk(jobs[0]);
+
+        // Stop at the first chunk that ends early, on a bad token or once
+        // count numbers are read
+        for (int c = 0; c < chunks; c++) {
+            done += jobs[c].parsed;
+            pos = jobs[c].stop-text;
+            if (jobs[c].bad)
+                return done;
+            if (jobs[c].parsed < jobs[c].tokens)
+                break;
+        }
+    }
+    return done;
+}
+
+qint64 TextReader::readChars(char *out, qint64 count) {
+    qint64 done = 0;
+    while (done < count && pos < size) {
+        // Copy up to the next whitespace (an egsphant row) in one go
+        const char *p = text+pos, *stop = text+qMin(size, pos+count-done);
+        while (p < stop && !isTextSpace(*p))
+            p++;
+        memcpy(out+done, text+pos, p-(text+pos));
+        done += p-(text+pos);
+        for (pos = p-text; pos < size && isTextSpace(text[pos]); pos++);
+    }
+    return done;
+}
+
+bool TextReader::atTokenEnd() const {
+    return pos <= 0 || pos >= size || isTextSpace(text[pos-1]) || isTextSpace(text[pos]);
+}
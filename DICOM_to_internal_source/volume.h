@@ -0,0 +1,257 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef VOLUME_H
+#define VOLUME_H
+
+#include <QtCore>
+#include <string.h>
+#include <algorithm>
+#include <iostream>
+#include "grid.h"
+#ifdef Q_OS_UNIX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Where volumes of at least volumeScratchThreshold() bytes are kept as memory
+// mapped files instead of in memory, unset (the default) to never do so
+inline QString &volumeScratchDir() {
+    static QString dir;
+    return dir;
+}
+
+inline quint64 &volumeScratchThreshold() {
+    static quint64 bytes = (quint64)64 << 20;
+    return bytes;
+}
+
+// A 3D array of voxels in one aligned block, laid out the same way as the
+// egsphant and 3ddose files (x fastest, then y, then z), meant for plain
+// types like char, float and double
+//
+// Volumes bigger than the scratch threshold live in a mapped scratch file, so
+// grids larger than memory can be worked through one slab of slices at a time,
+// prefetch and release tell the system which slabs are needed next and which
+// ones can be dropped from memory
+template <class T> class Volume {
+public:
+    Volume() {
+        nx = ny = nz = 0;
+        buf = NULL;
+        file = NULL;
+    }
+
+    Volume(int x, int y, int z, T value = T()) {
+        nx = ny = nz = 0;
+        buf = NULL;
+        file = NULL;
+        resize(x, y, z, value);
+    }
+
+    Volume(const Volume <T> &other) {
+        nx = ny = nz = 0;
+        buf = NULL;
+        file = NULL;
+        *this = other;
+    }
+
+    ~Volume() {
+        clear();
+    }
+
+    // Leaves the volume empty if there is not enough memory, use copyFrom to
+    // find out
+    Volume <T> &operator=(const Volume <T> &other) {
+        copyFrom(other);
+        return *this;
+    }
+
+    // Copy other, returns false and leaves the volume empty if there is not
+    // enough memory
+    bool copyFrom(const Volume <T> &other) {
+        if (this == &other)
+            return true;
+        if (!allocate(other.nx, other.ny, other.nz))
+            return false;
+        if (buf != NULL)
+            memcpy(buf, other.buf, size()*sizeof(T));
+        return true;
+    }
+
+    // Reallocate to x by y by z voxels, all set to value, returns false and
+    // leaves the volume empty if there is not enough memory
+    bool resize(int x, int y, int z, T value = T()) {
+        if (!allocate(x, y, z))
+            return false;
+        fill(value);
+        return true;
+    }
+
+    // Exchange the voxels of the two volumes, nothing is copied
+    void swap(Volume <T> &other) {
+        qSwap(nx, other.nx);
+        qSwap(ny, other.ny);
+        qSwap(nz, other.nz);
+        qSwap(buf, other.buf);
+        qSwap(file, other.file);
+    }
+
+    void fill(T value) {
+        if (buf != NULL)
+            std::fill(buf, buf+size(), value);
+    }
+
+    void clear() {
+        if (file != NULL) {
+            file->unmap((uchar*)buf);
+            delete file; // which also removes it
+            file = NULL;
+        }
+        else if (buf != NULL) {
+            qFreeAligned(buf);
+        }
+        buf = NULL;
+        nx = ny = nz = 0;
+    }
+
+    // Slices k0 to k1-1 are about to be used
+    void prefetch(int k0, int k1) const {
+        advise(k0, k1, true);
+    }
+
+    // Slices k0 to k1-1 are done with for now, mapped slices are dropped from
+    // memory but stay in the scratch file
+    void release(int k0, int k1) const {
+        advise(k0, k1, false);
+    }
+
+    // Position of voxel (i,j,k) in data()
+    inline unsigned long int index(int i, int j, int k) const {
+        return ((unsigned long int)k*ny+j)*nx+i;
+    }
+
+    inline T &operator()(int i, int j, int k) {
+        return buf[index(i, j, k)];
+    }
+
+    inline const T &operator()(int i, int j, int k) const {
+        return buf[index(i, j, k)];
+    }
+
+    // Raw access, a row is nx voxels and a slice is nx*ny voxels
+    inline T *data() {return buf;}
+    inline const T *data() const {return buf;}
+    inline T *row(int j, int k) {return buf+index(0, j, k);}
+    inline const T *row(int j, int k) const {return buf+index(0, j, k);}
+    inline T *slice(int k) {return buf+index(0, 0, k);}
+    inline const T *slice(int k) const {return buf+index(0, 0, k);}
+
+    inline unsigned long int size() const {return (unsigned long int)nx*ny*nz;}
+    inline bool isEmpty() const {return buf == NULL;}
+    inline bool isMapped() const {return file != NULL;}
+    inline int sizeX() const {return nx;}
+    inline int sizeY() const {return ny;}
+    inline int sizeZ() const {return nz;}
+
+private:
+    int nx, ny, nz;
+    T *buf;
+    QTemporaryFile *file;
+
+    // Cache line aligned so whole rows can be handed to vectorized loops
+    bool allocate(int x, int y, int z) {
+        if (buf != NULL && size() == (unsigned long int)x*y*z) {
+            nx = x; ny = y; nz = z;
+            return true;
+        }
+        clear();
+        if ((unsigned long int)x*y*z == 0)
+            return true;
+
+        quint64 bytes = (quint64)x*y*z*sizeof(T);
+        if (!volumeScratchDir().isEmpty() && bytes >= volumeScratchThreshold()) {
+            file = new QTemporaryFile(volumeScratchDir()+"/volume_XXXXXX");
+            if (file->open() && file->resize(bytes))
+                buf = (T*)file->map(0, bytes);
+            if (buf == NULL) {
+                std::cout << "Could not map a scratch file in " << volumeScratchDir().toStdString()
+                          << ", keeping the volume in memory instead\n";
+                delete file;
+                file = NULL;
+            }
+            else {
+                nx = x; ny = y; nz = z;
+                return true;
+            }
+        }
+
+        buf = (T*)qMallocAligned(bytes, 64);
+        if (buf == NULL) {
+            std::cout << "Could not allocate a " << x << "x" << y << "x" << z << " volume\n";
+            return false;
+        }
+        nx = x; ny = y; nz = z;
+        return true;
+    }
+
+    void advise(int k0, int k1, bool willNeed) const {
+#ifdef Q_OS_UNIX
+        k0 = k0 < 0 ? 0 : k0;
+        k1 = k1 > nz ? nz : k1;
+        if (file == NULL || k0 >= k1)
+            return;
+
+        // madvise works on whole pages
+        quintptr page = sysconf(_SC_PAGESIZE);
+        quintptr begin = (quintptr)slice(k0), end = (quintptr)(buf+index(0, 0, k1));
+        begin -= begin%page;
+        if (willNeed) {
+            madvise((void*)begin, end-begin, MADV_WILLNEED);
+        }
+        else {
+            msync((void*)begin, end-begin, MS_ASYNC); // Start writing them out
+            madvise((void*)begin, end-begin, MADV_DONTNEED);
+        }
+#else
+        Q_UNUSED(k0);
+        Q_UNUSED(k1);
+        Q_UNUSED(willNeed);
+#endif
+    }
+};
+
+// Copy the plane n along axis out of a plain volume, the plane is laid out
+// with the lower of its two remaining axes fastest, so an x plane is indexed
+// [k*ny+j], a y plane [k*nx+i] and a z plane [j*nx+i]
+template <class T> void extractPlane(const Volume <T> &vol, Axis axis, int n, QVector <T> *out) {
+    int nx = vol.sizeX(), ny = vol.sizeY(), nz = vol.sizeZ();
+    if (axis == XAxis) {
+        out->resize(ny*nz);
+        for (int k = 0; k < nz; k++)
+            for (int j = 0; j < ny; j++)
+                (*out)[k*ny+j] = vol(n, j, k);
+    }
+    else if (axis == YAxis) {
+        out->resize(nx*nz);
+        for (int k = 0; k < nz; k++)
+            memcpy(out->data()+k*nx, vol.row(n, k), nx*sizeof(T));
+    }
+    else {
+        out->resize(nx*ny);
+        memcpy(out->data(), vol.slice(n), (unsigned long int)nx*ny*sizeof(T));
+    }
+}
+
+#endif
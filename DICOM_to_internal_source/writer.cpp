@@ -0,0 +1,244 @@
+#include "DICOM.h"
+
+DICOMWriter::DICOMWriter(database *l) {
+    lib = l;
+    isImplicit = true;
+	device = NULL;
+	file = NULL;
+	depth = 0;
+	group = 0;
+	groupStart = -1;
+	valueLength = 0;
+}
+
+DICOMWriter::~DICOMWriter() {
+	if (file != NULL)
+		close();
+}
+
+int DICOMWriter::open(QString p, bool implicit) {
+	file = new QFile(p);
+	if (!file->open(QIODevice::WriteOnly)) {
+		std::cout << "Could not open " << p.toStdString() << " for writing, quitting...\n";
+		delete file;
+		file = NULL;
+		return 0;
+	}
+	return open(file, implicit);
+}
+
+int DICOMWriter::open(QIODevice *d, bool implicit) {
+	if (d->isSequential()) {
+		std::cout << "Cannot write DICOM group lengths to a sequential device, quitting...\n";
+		return 0;
+	}
+
+	device = d;
+	isImplicit = implicit;
+	depth = 0;
+	group = 0;
+	groupStart = -1;
+	out.setDevice(device);
+	out.setByteOrder(QDataStream::LittleEndian);
+
+	// The preamble can be anything, as long as it is 128 bytes long
+	QByteArray header(preamble.left(128));
+	while (header.size() < 128)
+		header.append(' ');
+	header.append("DICM");
+	return out.writeRawData(header.constData(), header.size()) == header.size();
+}
+
+int DICOMWriter::close() {
+	int ok = finishGroup() && out.status() == QDataStream::Ok && depth == 0;
+	out.setDevice(NULL);
+	device = NULL;
+	if (file != NULL) {
+		file->close();
+		delete file;
+		file = NULL;
+	}
+	return ok;
+}
+
+QString DICOMWriter::lookupVR(unsigned short int g, unsigned short int e) {
+	Reference nearest = lib->binSearch(g, e, 0, lib->lib.size()-1);
+	if (nearest.tag[0] == g && nearest.tag[1] == e && nearest.vr.size() == 2)
+		return nearest.vr;
+	return "UN";
+}
+
+// Fill in the length of the group that was just finished
+int DICOMWriter::finishGroup() {
+	if (groupStart < 0)
+		return 1;
+
+	qint64 end = device->pos();
+	if (!device->seek(groupStart))
+		return 0;
+	out << (quint32)(end-groupStart-4);
+	groupStart = -1;
+	return device->seek(end);
+}
+
+// Called before anything of group g is written
+int DICOMWriter::startElement(unsigned short int g) {
+	if (device == NULL)
+		return 0;
+
+	// Starting a new group, so finish the last one and leave room for the
+	// length of this one
+	if (!depth && g != group && g != 0xFFFE) {
+		if (!finishGroup())
+			return 0;
+		group = g;
+		if (g == 0x0002 || groupLengths) {
+			out << (quint16)g << (quint16)0x0000;
+			if (g == 0x0002 || !isImplicit) {
+				out.writeRawData("UL", 2);
+				out << (quint16)4;
+			}
+			else {
+				out << (quint32)4;
+			}
+			groupStart = device->pos();
+			out << (quint32)0;
+		}
+	}
+	return 1;
+}
+
+int DICOMWriter::writeHeader(unsigned short int g, unsigned short int e, QString VR, unsigned long int n) {
+	if (!startElement(g))
+		return 0;
+
+	out << (quint16)g << (quint16)e;
+	if (g == 0xFFFE || (isImplicit && g != 0x0002)) {
+		out << (quint32)n;
+	}
+	else if (lib->implicitVR.contains(VR)) {
+		out.writeRawData(VR.toLatin1().constData(), 2);
+		out << (quint16)0 << (quint32)n;
+	}
+	else {
+		if (n > 0xFFFF) {
+			std::cout << "Value of (" << std::hex << g << "," << e << std::dec
+					  << ") is too long for VR " << VR.toStdString() << ", quitting...\n";
+			return 0;
+		}
+		out.writeRawData(VR.toLatin1().constData(), 2);
+		out << (quint16)n;
+	}
+	return out.status() == QDataStream::Ok;
+}
+
+int DICOMWriter::beginValue(unsigned short int g, unsigned short int e, QString VR, unsigned long int n) {
+	if (VR.isEmpty())
+		VR = lookupVR(g, e);
+	valueVR = VR;
+	valueLength = n;
+	return writeHeader(g, e, VR, n+n%2);
+}
+
+int DICOMWriter::writeValue(const unsigned char *data, unsigned long int n) {
+	// Straight from the caller's memory, in pieces QDataStream can handle
+	while (n > 0) {
+		int chunk = n < (unsigned long int)INT_MAX ? n : INT_MAX;
+		if (out.writeRawData((const char*)data, chunk) != chunk)
+			return 0;
+		data += chunk;
+		n -= chunk;
+	}
+	return 1;
+}
+
+int DICOMWriter::endValue() {
+	if (!(valueLength%2))
+		return 1;
+
+	// Text is padded with a space, everything else (including UI) with a null
+	QStringList text;
+	text << "AE" << "AS" << "CS" << "DA" << "DS" << "DT" << "IS" << "LO"
+		 << "LT" << "PN" << "SH" << "ST" << "TM" << "UT";
+	char pad = text.contains(valueVR) ? ' ' : '\0';
+	return out.writeRawData(&pad, 1) == 1;
+}
+
+int DICOMWriter::writeElement(unsigned short int g, unsigned short int e, QString VR,
+							  const unsigned char *data, unsigned long int n) {
+	// Group lengths are taken care of in writeHeader
+	if (e == 0x0000 && g != 0xFFFE)
+		return 1;
+
+	return beginValue(g, e, VR, n) && writeValue(data, n) && endValue();
+}
+
+int DICOMWriter::writeRaw(unsigned short int g, const unsigned char *data, unsigned long int n) {
+	return startElement(g) && writeValue(data, n);
+}
+
+int DICOMWriter::writeString(unsigned short int g, unsigned short int e, QString value) {
+	QByteArray text = value.toLatin1();
+	return writeElement(g, e, "", (const unsigned char*)(text.constData()), text.size());
+}
+
+int DICOMWriter::writeUS(unsigned short int g, unsigned short int e, unsigned short int value) {
+	unsigned char dat[2] = {(unsigned char)(value & 0xFF), (unsigned char)(value >> 8)};
+	return writeElement(g, e, "US", dat, 2);
+}
+
+int DICOMWriter::writeUL(unsigned short int g, unsigned short int e, unsigned int value) {
+	unsigned char dat[4] = {(unsigned char)(value & 0xFF), (unsigned char)((value >> 8) & 0xFF),
+							(unsigned char)((value >> 16) & 0xFF), (unsigned char)(value >> 24)};
+	return writeElement(g, e, "UL", dat, 4);
+}
+
+int DICOMWriter::writeAT(unsigned short int g, unsigned short int e, unsigned short int g2, unsigned short int e2) {
+	unsigned char dat[4] = {(unsigned char)(g2 & 0xFF), (unsigned char)(g2 >> 8),
+							(unsigned char)(e2 & 0xFF), (unsigned char)(e2 >> 8)};
+	return writeElement(g, e, "AT", dat, 4);
+}
+
+int DICOMWriter::writeIS(unsigned short int g, unsigned short int e, int value) {
+	QByteArray text = QString::number(value).toLatin1();
+	return writeElement(g, e, "IS", (const unsigned char*)(text.constData()), text.size());
+}
+
+int DICOMWriter::writeDS(unsigned short int g, unsigned short int e, QVector <double> values) {
+	// Up to 10 significant figures, fewer where the sign and exponent leave no
+	// room in the 16 characters DS allows (-1.234567891e-100 is 17)
+	QByteArray text, value;
+	for (int i = 0; i < values.size(); i++) {
+		if (i)
+			text.append('\\');
+		for (int digits = 10; digits > 0; digits--) {
+			value = QString::number(values[i], 'g', digits).toLatin1();
+			if (value.size() <= 16)
+				break;
+		}
+		text.append(value);
+	}
+	return writeElement(g, e, "DS", (const unsigned char*)(text.constData()), text.size());
+}
+
+int DICOMWriter::beginSequence(unsigned short int g, unsigned short int e) {
+	if (!writeHeader(g, e, "SQ", 0xFFFFFFFF))
+		return 0;
+	depth++;
+	return 1;
+}
+
+int DICOMWriter::beginItem() {
+	return writeHeader(0xFFFE, 0xE000, "", 0xFFFFFFFF);
+}
+
+int DICOMWriter::endItem() {
+	return writeHeader(0xFFFE, 0xE00D, "", 0);
+}
+
+int DICOMWriter::endSequence() {
+	if (!depth || !writeHeader(0xFFFE, 0xE0DD, "", 0))
+		return 0;
+	depth--;
+	return 1;
+}
@@ -0,0 +1,355 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "compare.h"
+
+void MediaTally::resize(int n) {
+    for (int p = 0; p < 2; p++) {
+        count[p].fill(0, n);
+        volume[p].fill(0, n);
+        mass[p].fill(0, n);
+    }
+}
+
+void MediaTally::add(const MediaTally &other) {
+    for (int p = 0; p < 2; p++)
+        for (int n = 0; n < count[p].size(); n++) {
+            count[p][n] += other.count[p][n];
+            volume[p][n] += other.volume[p][n];
+            mass[p][n] += other.mass[p][n];
+        }
+}
+
+static void compareSliceJob(CompareSlice &slice) {
+    slice.compare->compareSlice(slice);
+}
+
+// Right aligned in a column of the given width
+static std::string column(double v, int width, int precision) {
+    return QString("%1").arg(v, width, 'f', precision).toStdString();
+}
+
+static std::string column(QString s, int width) {
+    return QString("%1").arg(s, width).toStdString();
+}
+
+PhantCompare::PhantCompare(PhantStream *first, PhantStream *second, const QVector <PhantStream*> &maskList,
+                           const QVector <QString> &maskNames, int numBins, double binRange) {
+    a = first;
+    b = second;
+    maskStreams = maskList;
+    names = maskNames;
+    bins = numBins < 1 ? 1 : numBins;
+    range = binRange;
+    writeDiff = false;
+
+    // Media are matched by name, as the same medium can have a different
+    // character in each phantom
+    PhantStream *p[2] = {a, b};
+    for (int l = 0; l < 2; l++) {
+        code[l].fill(-1, 256);
+        if (p[l] == NULL)
+            continue;
+        for (int n = 0; n < p[l]->media.size(); n++) {
+            int index = media.indexOf(p[l]->media[n]);
+            if (index < 0) {
+                index = media.size();
+                media << p[l]->media[n];
+            }
+            char c = 49 + n + (n>8?7:0) + (n>34?6:0);
+            code[l][(unsigned char)c] = index;
+        }
+    }
+
+    dx.resize(a->nx);
+    for (int i = 0; i < a->nx; i++)
+        dx[i] = a->x[i+1]-a->x[i];
+    dy.resize(a->ny);
+    for (int j = 0; j < a->ny; j++)
+        dy[j] = a->y[j+1]-a->y[j];
+
+    total.resize(media.size());
+    masks.resize(maskStreams.size());
+    for (int l = 0; l < masks.size(); l++)
+        masks[l].resize(media.size());
+    confusion.fill(0, b == NULL ? 0 : media.size()*media.size());
+    histogram.fill(0, b == NULL ? 0 : bins+2);
+    sum = sum2 = maxDiff = 0;
+    maxAt[0] = maxAt[1] = maxAt[2] = -1;
+}
+
+void PhantCompare::compareSlice(CompareSlice &slice) {
+    int nx = a->nx, ny = a->ny, numMedia = media.size();
+    long int n = long(nx)*ny;
+    double dz = a->z[slice.k+1]-a->z[slice.k];
+
+    // Read this slice of every file
+    QVector <char> m[2];
+    QVector <double> d[2];
+    QVector <QVector <char> > in(maskStreams.size());
+    m[0].resize(n);
+    d[0].resize(n);
+    slice.read = a->readSlice(slice.k, m[0].data(), d[0].data());
+    if (b != NULL) {
+        m[1].resize(n);
+        d[1].resize(n);
+        slice.read = b->readSlice(slice.k, m[1].data(), d[1].data()) && slice.read;
+    }
+    for (int l = 0; l < in.size(); l++) {
+        in[l].resize(n);
+        slice.read = maskStreams[l]->readSlice(slice.k, in[l].data(), NULL) && slice.read;
+    }
+    if (!slice.read)
+        return;
+
+    slice.total.resize(numMedia);
+    slice.masks.resize(maskStreams.size());
+    for (int l = 0; l < slice.masks.size(); l++)
+        slice.masks[l].resize(numMedia);
+    slice.confusion.fill(0, confusion.size());
+    slice.histogram.fill(0, histogram.size());
+    slice.sum = slice.sum2 = slice.maxDiff = 0;
+    slice.maxI = slice.maxJ = -1;
+    slice.doseText.clear();
+    slice.mediaText.clear();
+
+    int phants = b == NULL ? 1 : 2, med[2];
+    double vol, diff, width = 2.0*range/bins;
+    long int v;
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            v = long(j)*nx+i;
+            vol = dx[i]*dy[j]*dz;
+
+            for (int p = 0; p < phants; p++) {
+                med[p] = code[p][(unsigned char)m[p][v]];
+                if (med[p] < 0)
+                    continue;
+                slice.total.count[p][med[p]]++;
+                slice.total.volume[p][med[p]] += vol;
+                slice.total.mass[p][med[p]] += vol*d[p][v];
+                for (int l = 0; l < in.size(); l++)
+                    if (PhantStream::mediumIndex(in[l][v]) > 0) {
+                        slice.masks[l].count[p][med[p]]++;
+                        slice.masks[l].volume[p][med[p]] += vol;
+                        slice.masks[l].mass[p][med[p]] += vol*d[p][v];
+                    }
+            }
+            if (b == NULL)
+                continue;
+
+            if (med[0] >= 0 && med[1] >= 0)
+                slice.confusion[med[0]*numMedia+med[1]]++;
+
+            diff = d[1][v]-d[0][v];
+            if (diff < -range)
+                slice.histogram[0]++;
+            else if (diff >= range)
+                slice.histogram[bins+1]++;
+            else
+                slice.histogram[qMin(bins, 1+int((diff+range)/width))]++;
+            slice.sum += diff;
+            slice.sum2 += diff*diff;
+            if (fabs(diff) > fabs(slice.maxDiff)) {
+                slice.maxDiff = diff;
+                slice.maxI = i;
+                slice.maxJ = j;
+            }
+
+            if (writeDiff) {
+                slice.doseText += QByteArray::number(diff);
+                slice.doseText += ' ';
+                slice.mediaText += med[0] == med[1] ? '1' : '2';
+            }
+        }
+        if (writeDiff)
+            slice.mediaText += '\n';
+    }
+    if (writeDiff)
+        slice.mediaText += '\n';
+}
+
+void PhantCompare::merge(const CompareSlice &slice) {
+    total.add(slice.total);
+    for (int l = 0; l < masks.size(); l++)
+        masks[l].add(slice.masks[l]);
+    for (int n = 0; n < confusion.size(); n++)
+        confusion[n] += slice.confusion[n];
+    for (int n = 0; n < histogram.size(); n++)
+        histogram[n] += slice.histogram[n];
+    sum += slice.sum;
+    sum2 += slice.sum2;
+    if (fabs(slice.maxDiff) > fabs(maxDiff)) {
+        maxDiff = slice.maxDiff;
+        maxAt[0] = slice.maxI;
+        maxAt[1] = slice.maxJ;
+        maxAt[2] = slice.k;
+    }
+}
+
+int PhantCompare::run(QString diffPrefix) {
+    writeDiff = b != NULL && !diffPrefix.isEmpty();
+    QFile doseFile(diffPrefix+".3ddose"), mediaFile(diffPrefix+".egsphant");
+    int nx = a->nx, ny = a->ny, nz = a->nz;
+
+    if (writeDiff) {
+        if (!doseFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            std::cout << "Could not open " << doseFile.fileName().toStdString() << " for writing, quitting...\n";
+            return 0;
+        }
+        if (!mediaFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            std::cout << "Could not open " << mediaFile.fileName().toStdString() << " for writing, quitting...\n";
+            return 0;
+        }
+
+        // The boundaries, as Dose::readOut and Mask::saveEGSPhantFile write them
+        QByteArray bounds;
+        const QVector <double> *bound[3] = {&a->x, &a->y, &a->z};
+        for (int l = 0; l < 3; l++) {
+            for (int i = 0; i < bound[l]->size(); i++)
+                bounds += QByteArray::number((*bound[l])[i]) + ' ';
+            bounds += '\n';
+        }
+        QByteArray size = QByteArray::number(nx) + ' ' + QByteArray::number(ny) + ' ' + QByteArray::number(nz) + '\n';
+        doseFile.write(size + bounds);
+        mediaFile.write(QByteArray("2\nOTHER\nTARGET\n0.50 0.50 \n") + size + bounds);
+    }
+
+    // Slices are compared a batch at a time, so that the difference volumes
+    // can be written in order without holding more than a batch of them
+    int batch = qMax(1, QThread::idealThreadCount()*2);
+    QVector <CompareSlice> slices;
+    for (int k0 = 0; k0 < nz; k0 += batch) {
+        slices.resize(qMin(batch, nz-k0));
+        for (int n = 0; n < slices.size(); n++) {
+            slices[n].compare = this;
+            slices[n].k = k0+n;
+        }
+        QtConcurrent::blockingMap(slices, compareSliceJob);
+
+        for (int n = 0; n < slices.size(); n++) {
+            if (!slices[n].read) {
+                std::cout << "Could not read slice " << slices[n].k+1 << " of every file, quitting...\n";
+                return 0;
+            }
+            merge(slices[n]);
+            if (writeDiff) {
+                doseFile.write(slices[n].doseText);
+                mediaFile.write(slices[n].mediaText);
+            }
+        }
+    }
+
+    if (writeDiff) {
+        // There are no errors on the differences and no densities in the
+        // media mask, so both end in rows of zeros
+        QByteArray zeros;
+        for (int i = 0; i < nx; i++)
+            zeros += "0 ";
+        doseFile.write("\n");
+        for (long int r = 0; r < long(ny)*nz; r++)
+            doseFile.write(zeros);
+        doseFile.write("\n\n");
+
+        mediaFile.write("\n");
+        zeros += '\n';
+        for (int k = 0; k < nz; k++) {
+            for (int j = 0; j < ny; j++)
+                mediaFile.write(zeros);
+            mediaFile.write("\n");
+        }
+
+        if (doseFile.error() != QFile::NoError || mediaFile.error() != QFile::NoError) {
+            std::cout << "Could not write the difference volumes, quitting...\n";
+            return 0;
+        }
+        doseFile.close();
+        mediaFile.close();
+    }
+    return 1;
+}
+
+void PhantCompare::reportTally(const MediaTally &tally) const {
+    int width = 8;
+    for (int n = 0; n < media.size(); n++)
+        width = qMax(width, media[n].size()+2);
+
+    std::cout << column("Medium", -width);
+    if (b == NULL)
+        std::cout << column("Voxels", 14) << column("Volume (cm^3)", 16) << column("Mass (g)", 14) << "\n";
+    else
+        std::cout << column("Voxels A", 14) << column("Voxels B", 14) << column("Volume A (cm^3)", 18)
+                  << column("Volume B (cm^3)", 18) << column("Mass A (g)", 14) << column("Mass B (g)", 14)
+                  << column("Mass B-A (g)", 14) << "\n";
+
+    for (int n = 0; n < media.size(); n++) {
+        if (!tally.count[0][n] && (b == NULL || !tally.count[1][n]))
+            continue;
+        std::cout << column(media[n], -width);
+        if (b == NULL)
+            std::cout << column(tally.count[0][n], 14, 0) << column(tally.volume[0][n], 16, 3)
+                      << column(tally.mass[0][n], 14, 3) << "\n";
+        else
+            std::cout << column(tally.count[0][n], 14, 0) << column(tally.count[1][n], 14, 0)
+                      << column(tally.volume[0][n], 18, 3) << column(tally.volume[1][n], 18, 3)
+                      << column(tally.mass[0][n], 14, 3) << column(tally.mass[1][n], 14, 3)
+                      << column(tally.mass[1][n]-tally.mass[0][n], 14, 3) << "\n";
+    }
+}
+
+void PhantCompare::report() const {
+    std::cout << "\nMedia of the whole phantom\n";
+    reportTally(total);
+
+    if (b != NULL) {
+        int numMedia = media.size();
+        double voxels = 0, changed = 0;
+        for (int r = 0; r < numMedia; r++)
+            for (int c = 0; c < numMedia; c++) {
+                voxels += confusion[r*numMedia+c];
+                changed += r == c ? 0 : confusion[r*numMedia+c];
+            }
+
+        // Rows are the media of A and columns those of B, numbered as listed
+        std::cout << "\nMedia of A (rows) against media of B (columns)\n" << column("", 6);
+        for (int c = 0; c < numMedia; c++)
+            std::cout << column(QString::number(c+1), 12);
+        std::cout << "\n";
+        for (int r = 0; r < numMedia; r++) {
+            std::cout << column(QString::number(r+1), 6);
+            for (int c = 0; c < numMedia; c++)
+                std::cout << column(confusion[r*numMedia+c], 12, 0);
+            std::cout << "   " << media[r].toStdString() << "\n";
+        }
+        std::cout << "Voxels that changed medium: " << changed << " ("
+                  << (voxels > 0 ? changed/voxels*100.0 : 0) << "%)\n";
+
+        double n = double(a->nx)*a->ny*a->nz, width = 2.0*range/bins;
+        std::cout << "\nDensity differences B-A (g/cm^3)\n";
+        std::cout << column("Below " + QString::number(-range), -24) << column(histogram[0], 14, 0) << "\n";
+        for (int l = 1; l <= bins; l++)
+            std::cout << column(QString::number(-range+(l-1)*width) + " to " + QString::number(-range+l*width), -24)
+                      << column(histogram[l], 14, 0) << "\n";
+        std::cout << column("From " + QString::number(range), -24) << column(histogram[bins+1], 14, 0) << "\n";
+        std::cout << "Mean difference " << sum/n << ", RMS difference " << sqrt(sum2/n) << "\n";
+        if (maxAt[2] >= 0)
+            std::cout << "Largest difference " << maxDiff << " at voxel (" << maxAt[0]+1 << ", "
+                      << maxAt[1]+1 << ", " << maxAt[2]+1 << ")\n";
+    }
+
+    for (int l = 0; l < masks.size(); l++) {
+        std::cout << "\nMedia within " << names[l].toStdString() << "\n";
+        reportTally(masks[l]);
+    }
+}
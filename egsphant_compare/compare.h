@@ -0,0 +1,85 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef COMPARE_H
+#define COMPARE_H
+
+#include <QtConcurrent>
+#include "phantstream.h"
+
+// The voxel count, volume (cm^3) and mass (g) of each medium in some region,
+// for the first ([0]) and second ([1]) phantom
+struct MediaTally {
+    QVector <double> count[2], volume[2], mass[2];
+
+    void resize(int n);
+    void add(const MediaTally &other);
+};
+
+class PhantCompare;
+
+// Everything one slice adds to a comparison
+struct CompareSlice {
+    PhantCompare *compare;
+    int k;
+    int read; // 0 if a slice could not be read
+    MediaTally total;
+    QVector <MediaTally> masks;
+    QVector <double> confusion, histogram;
+    double sum, sum2, maxDiff; // of the density differences
+    int maxI, maxJ;
+    QByteArray doseText, mediaText; // the slice of each difference volume
+};
+
+// Compares the media and densities of phantom a with those of phantom b (if
+// not NULL) and within each mask (whose voxels are in if they are not the
+// first medium), streaming slices of all of them through in parallel batches
+class PhantCompare {
+public:
+    PhantCompare(PhantStream *first, PhantStream *second, const QVector <PhantStream*> &maskList,
+                 const QVector <QString> &maskNames, int numBins, double binRange);
+
+    QVector <QString> media; // the media of both phantoms, matched by name
+    MediaTally total; // over the whole phantom
+    QVector <MediaTally> masks; // within each mask
+    QVector <double> confusion; // voxels of medium r in a and c in b at [r*media.size()+c]
+    QVector <double> histogram; // of b-a densities, under range first and over last
+    double sum, sum2, maxDiff; // of b-a densities
+    int maxAt[3]; // the voxel of maxDiff
+
+    // Run the comparison, also writing the density difference to
+    // diffPrefix.3ddose and voxels that changed medium to diffPrefix.egsphant
+    // if diffPrefix is not empty, returns 0 if they could not be written
+    int run(QString diffPrefix);
+
+    // Print the tables of everything found to std::cout
+    void report() const;
+
+    void compareSlice(CompareSlice &slice);
+
+private:
+    PhantStream *a, *b;
+    QVector <PhantStream*> maskStreams;
+    QVector <QString> names;
+    QVector <int> code[2]; // media index of each character of a and b
+    QVector <double> dx, dy; // voxel widths
+    int bins;
+    double range;
+    bool writeDiff;
+
+    void merge(const CompareSlice &slice);
+    void reportTally(const MediaTally &tally) const;
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "compare.h"
+
+int main(int argc, char **argv) {
+	// Start clock for timing
+    std::clock_t start;
+    double duration;
+    start = std::clock();
+	
+	if (argc == 1) {
+        std::cout << "Please call this program with one or two .egsphant or .begsphant files, and optionally\n"
+				  << "\"mask=M\" (any number of mask egsphants to tally media within), \"bins=N\" and\n"
+				  << "\"range=X\" (N bins of density differences from -X to X g/cm^3, 20 and 0.5 by\n"
+				  << "default) and \"diff=P\" (write the density difference to P.3ddose and the voxels\n"
+				  << "that changed medium to P.egsphant).\n";
+        return 0;
+    }
+	
+	QVector <QString> phants, maskPaths;
+	QString diffPrefix;
+	int bins = 20;
+	double range = 0.5;
+	
+    for (int i = 0; i < argc-1; i++) {
+        QString path(argv[i+1]);
+		
+        if (!path.left(5).compare("mask=")) {
+			maskPaths << (path.right(path.size()-5));
+		}
+        else if (!path.left(5).compare("bins=")) {
+			bins = (path.right(path.size()-5)).toInt();
+		}
+        else if (!path.left(6).compare("range=")) {
+			range = (path.right(path.size()-6)).toDouble();
+		}
+        else if (!path.left(5).compare("diff=")) {
+			diffPrefix = (path.right(path.size()-5));
+		}
+		else if (!path.right(9).compare(".egsphant") || !path.right(10).compare(".begsphant")) {
+			phants << path;
+		}
+		else {
+			std::cout << "egsphant_compare invoked with arguments which are not \"mask=M\", \"bins=N\", \"range=X\", \"diff=P\" and egsphant files, exiting.\n";
+			return 0;
+		}
+    }
+	
+	if (phants.size() < 1 || phants.size() > 2) {
+		std::cout << "Please pass one phantom (with masks) or two phantoms to compare, exiting.\n";
+		return 0;
+	}
+	if (phants.size() == 1 && maskPaths.isEmpty()) {
+		std::cout << "Only one phantom and no masks were passed, so there is nothing to compare, exiting.\n";
+		return 0;
+	}
+	if (bins < 1 || range <= 0) {
+		std::cout << "Did not read in a positive number of bins and range, exiting.\n";
+		return 0;
+	}
+	
+	// Every file is only mapped, slices are read as they are compared
+	PhantStream a, b;
+	QVector <PhantStream*> masks;
+	QVector <QString> maskNames;
+	int ok = a.open(phants[0]);
+	if (ok && phants.size() == 2) {
+		ok = b.open(phants[1]);
+		if (ok && !a.sameGrid(b, 1e-4)) {
+			std::cout << "The two phantoms do not have the same voxels, exiting.\n";
+			ok = 0;
+		}
+	}
+	for (int i = 0; ok && i < maskPaths.size(); i++) {
+		masks << new PhantStream;
+		ok = masks.last()->open(maskPaths[i]);
+		if (ok && !a.sameGrid(*masks.last(), 1e-4)) {
+			std::cout << "Mask " << maskPaths[i].toStdString() << " does not have the same voxels as the phantom, exiting.\n";
+			ok = 0;
+		}
+		maskNames << QFileInfo(maskPaths[i]).completeBaseName();
+	}
+	
+	if (ok) {
+		duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+		std::cout << "Indexed " << phants.size()+maskPaths.size() << " files of " << a.nx << "x" << a.ny << "x" << a.nz
+				  << " voxels.  Time elapsed is " << duration << " s.\n";
+		
+		PhantCompare compare(&a, phants.size() == 2 ? &b : NULL, masks, maskNames, bins, range);
+		ok = compare.run(diffPrefix);
+		if (ok) {
+			duration = (std::clock()-start)/(double)CLOCKS_PER_SEC;
+			std::cout << "Compared every slice.  Time elapsed is " << duration << " s.\n";
+			compare.report();
+		}
+	}
+	
+	for (int i = 0; i < masks.size(); i++)
+		delete masks[i];
+    return ok;
+}
@@ -0,0 +1,270 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#include "phantstream.h"
+
+// Step over spaces and line breaks
+static inline const char *skipSpace(const char *p, const char *end) {
+    while (p < end && isspace((unsigned char)*p))
+        p++;
+    return p;
+}
+
+// Step over one whitespace separated value, NULL if there is none
+static inline const char *skipValue(const char *p, const char *end) {
+    p = skipSpace(p, end);
+    const char *start = p;
+    while (p < end && !isspace((unsigned char)*p))
+        p++;
+    return p == start ? NULL : p;
+}
+
+// Read one whitespace separated number into v, returns where it ends or NULL
+// if there is none, the value is copied out as the map is not null terminated
+static inline const char *readNumber(const char *p, const char *end, double *v) {
+    p = skipSpace(p, end);
+    char buffer[64];
+    int n = 0;
+    while (p < end && !isspace((unsigned char)*p) && n < 63)
+        buffer[n++] = *(p++);
+    if (!n)
+        return NULL;
+    buffer[n] = 0;
+    char *stop;
+    *v = strtod(buffer, &stop);
+    return stop == buffer ? NULL : p;
+}
+
+// The rest of the line starting at p, and move p to the start of the next
+static inline QString readLine(const char *&p, const char *end) {
+    const char *start = p;
+    while (p < end && *p != '\n')
+        p++;
+    QString line = QString::fromLatin1(start, p-start).trimmed();
+    if (p < end)
+        p++;
+    return line;
+}
+
+PhantStream::PhantStream() {
+    nx = ny = nz = 0;
+    data = end = NULL;
+    binary = false;
+}
+
+PhantStream::~PhantStream() {
+    close();
+}
+
+int PhantStream::open(QString path) {
+    close();
+    binary = path.endsWith(".begsphant");
+    file.setFileName(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        std::cout << "Could not open " << path.toStdString() << " for reading, quitting...\n";
+        return 0;
+    }
+
+    if (file.size() > 0)
+        data = (const char*)file.map(0, file.size());
+    if (data == NULL) {
+        std::cout << "Could not map " << path.toStdString() << " into memory, quitting...\n";
+        close();
+        return 0;
+    }
+    end = data+file.size();
+
+    if (!(binary ? indexBinary() : indexText())) {
+        std::cout << path.toStdString() << " is not a complete " << (binary ? "begsphant" : "egsphant")
+                  << " file, quitting...\n";
+        close();
+        return 0;
+    }
+    return 1;
+}
+
+void PhantStream::close() {
+    if (data != NULL)
+        file.unmap((uchar*)data);
+    if (file.isOpen())
+        file.close();
+    data = end = NULL;
+    nx = ny = nz = 0;
+    x.clear();
+    y.clear();
+    z.clear();
+    media.clear();
+    mediaStart.clear();
+    densityStart.clear();
+}
+
+int PhantStream::indexText() {
+    const char *p = data;
+    double v;
+
+    // The media, ESTEP line and dimensions, laid out as saveEGSPhantFile does
+    int num = readLine(p, end).toInt();
+    if (num < 1)
+        return 0;
+    for (int i = 0; i < num; i++)
+        media << readLine(p, end);
+    readLine(p, end);
+
+    int n[3];
+    for (int l = 0; l < 3; l++) {
+        if ((p = readNumber(p, end, &v)) == NULL || v < 1)
+            return 0;
+        n[l] = int(v);
+    }
+    nx = n[0];
+    ny = n[1];
+    nz = n[2];
+
+    QVector <double> *b[3] = {&x, &y, &z};
+    for (int l = 0; l < 3; l++) {
+        b[l]->resize(n[l]+1);
+        for (int i = 0; i <= n[l]; i++)
+            if ((p = readNumber(p, end, &(*b[l])[i])) == NULL)
+                return 0;
+    }
+
+    // Media rows are always nx characters, so each slice can be stepped over
+    // a row at a time
+    mediaStart.resize(nz);
+    for (int k = 0; k < nz; k++)
+        for (int j = 0; j < ny; j++) {
+            p = skipSpace(p, end);
+            if (!j)
+                mediaStart[k] = p-data;
+            if (end-p < nx)
+                return 0;
+            p += nx;
+        }
+
+    // Densities are as long as they are written, so each has to be skipped
+    densityStart.resize(nz);
+    for (int k = 0; k < nz; k++) {
+        densityStart[k] = skipSpace(p, end)-data;
+        for (long int n = 0; n < long(nx)*ny; n++)
+            if ((p = skipValue(p, end)) == NULL)
+                return 0;
+    }
+    return 1;
+}
+
+int PhantStream::indexBinary() {
+    QByteArray bytes = QByteArray::fromRawData(data, end-data);
+    QDataStream input(bytes);
+    input.setByteOrder(QDataStream::LittleEndian);
+
+    // The header as savebEGSPhantFile writes it
+    int num;
+    double estep;
+    input >> num;
+    if (num < 1 || input.status() != QDataStream::Ok)
+        return 0;
+    media.resize(num);
+    for (int i = 0; i < num; i++)
+        input >> media[i];
+    for (int i = 0; i < num; i++)
+        input >> estep;
+    input >> nx >> ny >> nz;
+    if (input.status() != QDataStream::Ok || nx < 1 || ny < 1 || nz < 1)
+        return 0;
+
+    x.resize(nx+1);
+    y.resize(ny+1);
+    z.resize(nz+1);
+    for (int i = 0; i <= nx; i++)
+        input >> x[i];
+    for (int i = 0; i <= ny; i++)
+        input >> y[i];
+    for (int i = 0; i <= nz; i++)
+        input >> z[i];
+    if (input.status() != QDataStream::Ok)
+        return 0;
+
+    // Then all the media, one byte each, and all the densities, eight each
+    qint64 p = input.device()->pos(), n = qint64(nx)*ny;
+    if (end-data < p+n*nz*9)
+        return 0;
+    mediaStart.resize(nz);
+    densityStart.resize(nz);
+    for (int k = 0; k < nz; k++) {
+        mediaStart[k] = p+n*k;
+        densityStart[k] = p+n*nz+n*k*8;
+    }
+    return 1;
+}
+
+bool PhantStream::sameGrid(const PhantStream &other, double tolerance) const {
+    if (nx != other.nx || ny != other.ny || nz != other.nz)
+        return false;
+    for (int i = 0; i <= nx; i++)
+        if (fabs(x[i]-other.x[i]) > tolerance)
+            return false;
+    for (int j = 0; j <= ny; j++)
+        if (fabs(y[j]-other.y[j]) > tolerance)
+            return false;
+    for (int k = 0; k <= nz; k++)
+        if (fabs(z[k]-other.z[k]) > tolerance)
+            return false;
+    return true;
+}
+
+int PhantStream::mediumIndex(char c) {
+    // The inverse of the 49 + n + (n>8?7:0) + (n>34?6:0) used to write them
+    if (c >= '1' && c <= '9')
+        return c-'1';
+    if (c >= 'A' && c <= 'Z')
+        return c-'A'+9;
+    if (c >= 'a' && c <= 'z')
+        return c-'a'+35;
+    return -1;
+}
+
+int PhantStream::readSlice(int k, char *m, double *d) const {
+    if (data == NULL || k < 0 || k >= nz)
+        return 0;
+    long int n = long(nx)*ny;
+
+    if (binary) {
+        if (m != NULL)
+            memcpy(m, data+mediaStart[k], n);
+        if (d != NULL) {
+            const uchar *p = (const uchar*)(data+densityStart[k]);
+            quint64 bits;
+            for (long int i = 0; i < n; i++, p += 8) {
+                bits = qFromLittleEndian<quint64>(p);
+                memcpy(d+i, &bits, 8);
+            }
+        }
+        return 1;
+    }
+
+    if (m != NULL) {
+        const char *p = data+mediaStart[k];
+        for (int j = 0; j < ny; j++, p += nx) {
+            p = skipSpace(p, end);
+            memcpy(m+long(j)*nx, p, nx);
+        }
+    }
+    if (d != NULL) {
+        const char *p = data+densityStart[k];
+        for (long int i = 0; i < n; i++)
+            if ((p = readNumber(p, end, d+i)) == NULL)
+                return 0;
+    }
+    return 1;
+}
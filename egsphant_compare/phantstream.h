@@ -0,0 +1,61 @@
+/***********************************************************************
+************************************************************************
+*    This code is part of a PRE-RELEASE VERSION of 3ddose_tools,       *
+*    a *.3ddose file analysis code.                                    *
+*    Copyright 2014 by Carleton University, Ottawa, Canada             *
+*    GNU GENERAL PUBLIC LICENSE                                        *
+*    Version 3, 29 June 2007                                           *
+*                                                                      *
+*    Please report all problems to:                                    *
+*    Martin Martinov martinov@physics.carleton.ca                      *
+*    Rowan Thomson rthomson@physics.carleton.ca                        *
+************************************************************************
+***********************************************************************/
+
+#ifndef PHANTSTREAM_H
+#define PHANTSTREAM_H
+
+#include <QtCore>
+#include <iostream>
+#include <math.h>
+
+// Reads an egsphant (text) or begsphant (binary) one slice at a time straight
+// out of the memory mapped file, so that a phantom never has to be held in
+// memory, the header and where each slice starts are found when it is opened
+class PhantStream {
+public:
+    PhantStream();
+    ~PhantStream();
+
+    int nx, ny, nz; // these hold the number of voxels
+    QVector <double> x, y, z; // these hold the boundaries of the above voxels
+    QVector <QString> media; // this holds all the possible media
+
+    // Map the file at path and index its slices, the format is taken from
+    // the extension, returns 0 (with a message) if it could not be read
+    int open(QString path);
+    void close();
+
+    // Whether other has the same number of voxels and boundaries within
+    // tolerance (cm)
+    bool sameGrid(const PhantStream &other, double tolerance) const;
+
+    // The medium (index into media) of the character c used for it in the
+    // file, -1 if c is not a medium
+    static int mediumIndex(char c);
+
+    // Copy the media and densities of slice k into m and d (nx*ny each, rows
+    // of nx), either may be NULL, may be called from several threads at once
+    int readSlice(int k, char *m, double *d) const;
+
+private:
+    QFile file;
+    const char *data, *end;
+    bool binary;
+    QVector <qint64> mediaStart, densityStart; // offsets of each slice
+
+    int indexText();
+    int indexBinary();
+};
+
+#endif